@@ -74,6 +74,7 @@ function(tinyorm_sources out_headers out_sources)
         ormtypes.hpp
         postgresconnection.hpp
         query/concerns/buildsqueries.hpp
+        query/cursor.hpp
         query/expression.hpp
         query/grammars/grammar.hpp
         query/grammars/mysqlgrammar.hpp
@@ -103,10 +104,21 @@ function(tinyorm_sources out_headers out_sources)
         schema/schematypes.hpp
         schema/sqliteschemabuilder.hpp
         sqliteconnection.hpp
+        support/connectionlease.hpp
+        support/connectionpool.hpp
         support/databaseconfiguration.hpp
         support/databaseconnectionsmap.hpp
+        support/jsonwriter.hpp
+        support/latencyhistograms.hpp
+        support/preparedstatementscache.hpp
+        support/queryanalyzer.hpp
+        support/readconnections.hpp
+        types/bindingsmap.hpp
+        types/connectionpoolstats.hpp
         types/log.hpp
+        types/queryissue.hpp
         types/sqlquery.hpp
+        types/statementlatency.hpp
         types/statementscounter.hpp
         utils/configuration.hpp
         utils/container.hpp
@@ -170,8 +182,11 @@ function(tinyorm_sources out_headers out_sources)
             tiny/tinybuilderproxies.hpp
             tiny/tinyconcepts.hpp
             tiny/tinytypes.hpp
+            tiny/types/attributeslayout.hpp
             tiny/types/connectionoverride.hpp
+            tiny/types/conversionplan.hpp
             tiny/types/modelattributes.hpp
+            tiny/types/modelmetadata.hpp
             tiny/types/modelscollection.hpp
             tiny/types/syncchanges.hpp
             tiny/utils/attribute.hpp
@@ -240,6 +255,14 @@ function(tinyorm_sources out_headers out_sources)
         schema/schemabuilder.cpp
         schema/sqliteschemabuilder.cpp
         sqliteconnection.cpp
+        support/connectionlease.cpp
+        support/connectionpool.cpp
+        support/jsonwriter.cpp
+        support/latencyhistograms.cpp
+        support/preparedstatementscache.cpp
+        support/queryanalyzer.cpp
+        support/readconnections.cpp
+        types/bindingsmap.cpp
         types/sqlquery.cpp
         utils/configuration.cpp
         utils/fs.cpp
@@ -66,6 +66,7 @@ headersList += \
     $$PWD/orm/ormtypes.hpp \
     $$PWD/orm/postgresconnection.hpp \
     $$PWD/orm/query/concerns/buildsqueries.hpp \
+    $$PWD/orm/query/cursor.hpp \
     $$PWD/orm/query/expression.hpp \
     $$PWD/orm/query/grammars/grammar.hpp \
     $$PWD/orm/query/grammars/mysqlgrammar.hpp \
@@ -95,10 +96,21 @@ headersList += \
     $$PWD/orm/schema/schematypes.hpp \
     $$PWD/orm/schema/sqliteschemabuilder.hpp \
     $$PWD/orm/sqliteconnection.hpp \
+    $$PWD/orm/support/connectionlease.hpp \
+    $$PWD/orm/support/connectionpool.hpp \
     $$PWD/orm/support/databaseconfiguration.hpp \
     $$PWD/orm/support/databaseconnectionsmap.hpp \
+    $$PWD/orm/support/jsonwriter.hpp \
+    $$PWD/orm/support/latencyhistograms.hpp \
+    $$PWD/orm/support/preparedstatementscache.hpp \
+    $$PWD/orm/support/queryanalyzer.hpp \
+    $$PWD/orm/support/readconnections.hpp \
+    $$PWD/orm/types/bindingsmap.hpp \
+    $$PWD/orm/types/connectionpoolstats.hpp \
     $$PWD/orm/types/log.hpp \
+    $$PWD/orm/types/queryissue.hpp \
     $$PWD/orm/types/sqlquery.hpp \
+    $$PWD/orm/types/statementlatency.hpp \
     $$PWD/orm/types/statementscounter.hpp \
     $$PWD/orm/utils/configuration.hpp \
     $$PWD/orm/utils/container.hpp \
@@ -161,8 +173,11 @@ headersList += \
         $$PWD/orm/tiny/tinybuilderproxies.hpp \
         $$PWD/orm/tiny/tinyconcepts.hpp \
         $$PWD/orm/tiny/tinytypes.hpp \
+        $$PWD/orm/tiny/types/attributeslayout.hpp \
         $$PWD/orm/tiny/types/connectionoverride.hpp \
+        $$PWD/orm/tiny/types/conversionplan.hpp \
         $$PWD/orm/tiny/types/modelattributes.hpp \
+        $$PWD/orm/tiny/types/modelmetadata.hpp \
         $$PWD/orm/tiny/types/modelscollection.hpp \
         $$PWD/orm/tiny/types/syncchanges.hpp \
         $$PWD/orm/tiny/utils/attribute.hpp \
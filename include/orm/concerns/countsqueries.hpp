@@ -10,6 +10,7 @@ TINY_SYSTEM_HEADER
 #include <optional>
 
 #include "orm/macros/export.hpp"
+#include "orm/support/latencyhistograms.hpp"
 #include "orm/types/statementscounter.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -64,6 +65,31 @@ namespace Concerns
         /*! Reset the number of executed queries. */
         DatabaseConnection &resetStatementsCounter();
 
+        /* Prepared statements cache counter */
+        /*! Obtain the prepared statements cache counter, all counters are -1 when
+            the prepared statements cache is disabled. */
+        const PreparedStatementsCacheCounter &getPreparedStatementsCacheCounter() const;
+        /*! Obtain and reset the prepared statements cache counter. */
+        PreparedStatementsCacheCounter takePreparedStatementsCacheCounter();
+        /*! Reset the prepared statements cache counter. */
+        DatabaseConnection &resetPreparedStatementsCacheCounter();
+
+        /* Statements latency histograms */
+        /*! Determine whether we're recording statements latency histograms. */
+        bool countingLatencies() const;
+        /*! Enable recording statements latency histograms on the current connection. */
+        DatabaseConnection &enableLatencyHistograms();
+        /*! Disable recording statements latency histograms on the current connection
+            (recorded histograms are removed). */
+        DatabaseConnection &disableLatencyHistograms();
+        /*! Obtain statements latency histograms, ordered by the total execution time,
+            empty when disabled. */
+        std::vector<StatementLatency> getLatencyHistograms() const;
+        /*! Obtain and reset statements latency histograms. */
+        std::vector<StatementLatency> takeLatencyHistograms();
+        /*! Reset statements latency histograms. */
+        DatabaseConnection &resetLatencyHistograms();
+
     protected:
         /* Queries execution time counter */
         /*! Indicates whether queries elapsed time are being counted. */
@@ -77,10 +103,26 @@ namespace Concerns
         /*! Counts executed statements on current connection. */
         StatementsCounter m_statementsCounter {};
 
+        /* Prepared statements cache counter */
+        /*! Counts prepared statements cache hits, misses, and evictions. */
+        PreparedStatementsCacheCounter m_preparedStatementsCacheCounter {};
+
+        /* Statements latency histograms */
+        /*! Indicates whether statements latency histograms are being recorded. */
+        bool m_countingLatencies = false;
+        /*! Statements latency histograms keyed by the normalized SQL query. */
+        Support::LatencyHistograms m_latencyHistograms;
+
+        /*! Record the statement execution time into its latency histogram. */
+        void hitLatencyHistogram(const QString &queryString, StatementType type,
+                                 qint64 nsecs);
+
     private:
-        /*! Count transactional queries execution time and statements counter. */
+        /*! Count transactional queries execution time, statements counter, and
+            latency histograms. */
         std::optional<qint64>
-        hitTransactionalCounters(QElapsedTimer timer, bool countElapsed);
+        hitTransactionalCounters(const QString &queryString, QElapsedTimer timer,
+                                 bool countElapsed);
 
         /*! Dynamic cast *this to the DatabaseConnection & derived type. */
         DatabaseConnection &databaseConnection();
@@ -13,6 +13,7 @@ TINY_SYSTEM_HEADER
 #include "orm/config.hpp" // IWYU pragma: keep
 
 #include "orm/macros/export.hpp"
+#include "orm/support/queryanalyzer.hpp"
 #include "orm/types/log.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -25,7 +26,7 @@ class DatabaseConnection;
 namespace Concerns
 {
 
-    /*! Logs executed queries to the console. */
+    /*! Logs executed queries to the console, the query log, and analyzes them. */
     class SHAREDLIB_EXPORT LogsQueries
     {
         Q_DISABLE_COPY(LogsQueries)
@@ -54,17 +55,33 @@ namespace Concerns
         void logTransactionQueryForPretend(const QString &query) const;
 
         /*! Get the connection query log. */
-        inline std::shared_ptr<QVector<Log>> getQueryLog() const noexcept;
+        std::shared_ptr<QVector<Log>> getQueryLog() const;
         /*! Clear the query log. */
         void flushQueryLog();
-        /*! Enable the query log on the connection. */
-        void enableQueryLog();
+        /*! Enable the query log on the connection, the bounded query log keeps only
+            the given number of the most recent queries (0 is unbounded). */
+        void enableQueryLog(std::size_t maxSize = 0);
         /*! Disable the query log on the connection. */
         inline void disableQueryLog() noexcept;
         /*! Determine whether we're logging queries. */
         inline bool logging() const noexcept;
         /*! The current order value for a query log record. */
         inline static std::size_t getQueryLogOrder() noexcept;
+        /*! Get the maximum size of the bounded query log (0 is unbounded). */
+        inline std::size_t getQueryLogMaxSize() const noexcept;
+
+        /*! Enable analyzing of executed queries, the callback is invoked for slow
+            queries (threshold in milliseconds) and for the N+1 problem (number of
+            repeated select queries), the 0 threshold disables the detection. */
+        void enableQueryAnalyzer(Support::QueryAnalyzer::CallbackType callback,
+                                 qint64 slowQueryThreshold = 1000,
+                                 qint64 nPlusOneThreshold = 10);
+        /*! Disable analyzing of executed queries. */
+        void disableQueryAnalyzer();
+        /*! Determine whether we're analyzing executed queries. */
+        inline bool analyzingQueries() const noexcept;
+        /*! Forget the currently repeated query (eg. at the end of a request). */
+        void resetQueryAnalyzer();
 
         /*! Determine whether debugging SQL queries is enabled/disabled (logging
             to the console using qDebug()). */
@@ -79,10 +96,16 @@ namespace Concerns
         QVector<Log>
         withFreshQueryLog(const std::function<QVector<Log>()> &callback);
 
+        /*! Analyze the executed query (slow queries and the N+1 problem). */
+        void analyzeQuery(const QString &queryString, const QVector<QVariant> &bindings,
+                          StatementType type, qint64 nsecs);
+
         /*! Indicates if changes have been made to the database. */
         bool m_recordsModified = false;
         /*! All of the queries run against the connection. */
         std::shared_ptr<QVector<Log>> m_queryLog = nullptr;
+        /*! The query log analyzer, reports slow queries and the N+1 problem. */
+        std::optional<Support::QueryAnalyzer> m_queryAnalyzer = std::nullopt;
         /*! ID of the query log record. */
         inline static std::atomic<std::size_t> m_queryLogId = 0;
 
@@ -98,6 +121,11 @@ namespace Concerns
         /*! Log a query into the connection's query log. */
         void logQueryInternal(const QSqlQuery &query, std::optional<qint64> elapsed,
                               const QString &type) const;
+        /*! Append the record to the query log (overwrites the oldest record if
+            the bounded query log is full). */
+        void appendToQueryLog(Log &&log) const;
+        /*! Rotate the bounded query log so the oldest record is the first one. */
+        void rotateQueryLog() const;
 
         /*! Convert a named bindings map to the positional bindings vector. */
         static QVector<QVariant>
@@ -110,6 +138,10 @@ namespace Concerns
         bool m_loggingQueries = false;
         /*! All of the queries run against the connection. */
         std::shared_ptr<QVector<Log>> m_queryLogForPretend = nullptr;
+        /*! Maximum size of the bounded query log (0 is unbounded). */
+        std::size_t m_queryLogMaxSize = 0;
+        /*! Index of the oldest record in the full bounded query log (ring buffer). */
+        mutable std::size_t m_queryLogHead = 0;
     };
 
     /* public */
@@ -130,11 +162,6 @@ namespace Concerns
         logQueryInternal(std::get<1>(queryResult), elapsed, type);
     }
 
-    std::shared_ptr<QVector<Log>> LogsQueries::getQueryLog() const noexcept
-    {
-        return m_queryLog;
-    }
-
     void LogsQueries::disableQueryLog() noexcept
     {
         m_loggingQueries = false;
@@ -150,6 +177,16 @@ namespace Concerns
         return m_queryLogId;
     }
 
+    std::size_t LogsQueries::getQueryLogMaxSize() const noexcept
+    {
+        return m_queryLogMaxSize;
+    }
+
+    bool LogsQueries::analyzingQueries() const noexcept
+    {
+        return m_queryAnalyzer.has_value();
+    }
+
     bool LogsQueries::debugSql() const noexcept
     {
         return m_debugSql;
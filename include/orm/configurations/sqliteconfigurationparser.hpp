@@ -29,6 +29,17 @@ namespace Orm::Configurations
         void parseDriverSpecificOptions() const final;
         /*! Parse the driver-specific 'options' configuration option. */
         void parseDriverSpecificOptionsOption(QVariantHash &options) const final;
+
+    private:
+        /*! Validate and normalize (upper-case) the journal_mode, synchronous, and
+            temp_store PRAGMA options. */
+        void parseNamedPragmas() const;
+        /*! Validate and normalize the cache_size, mmap_size, busy_timeout, and
+            page_size PRAGMA options. */
+        void parseIntegerPragmas() const;
+        /*! Determine whether the given page size is a power of two between 512
+            and 65536. */
+        static bool isValidPageSize(qint64 pageSize) noexcept;
     };
 
 } // namespace Orm::Configurations
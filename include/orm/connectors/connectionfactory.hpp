@@ -10,6 +10,7 @@ TINY_SYSTEM_HEADER
 
 #include "orm/connectors/connectorinterface.hpp"
 #include "orm/ormtypes.hpp"
+#include "orm/support/readconnections.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -39,6 +40,11 @@ namespace Connectors
         static std::unique_ptr<ConnectorInterface>
         createConnector(const QVariantHash &config);
 
+        /*! Create a new Closure that resolves to a QSqlDatabase instance
+            ( only a connection name returned ). */
+        static std::function<ConnectionName()>
+        createQSqlDatabaseResolver(const QVariantHash &config);
+
     protected:
         /*! Parse and prepare the database configuration. */
         static QVariantHash
@@ -47,11 +53,23 @@ namespace Connectors
         /*! Create a single database connection  instance. */
         static std::shared_ptr<DatabaseConnection>
         createSingleConnection(QVariantHash &&config);
-        /*! Create a new Closure that resolves to a QSqlDatabase instance
-            ( only a connection name returned ). */
-        static std::function<ConnectionName()>
-        createQSqlDatabaseResolver(const QVariantHash &config);
-
+        /*! Create a read / write database connection instance. */
+        static std::shared_ptr<DatabaseConnection>
+        createReadWriteConnection(QVariantHash &&config);
+        /*! Create the read replicas for a read / write connection. */
+        static Support::ReadConnections
+        createReadConnections(const QVariantHash &config);
+
+        /*! Get the read configuration for a read / write connection. */
+        static QVariantHash getReadConfig(const QVariantHash &config);
+        /*! Get the write configuration for a read / write connection. */
+        static QVariantHash getWriteConfig(const QVariantHash &config);
+        /*! Merge a configuration for a read / write connection. */
+        static QVariantHash
+        mergeReadWriteConfig(const QVariantHash &config, const QVariantHash &merge);
+        /*! Parse the read_strategy configuration option. */
+        static Support::ReadConnections::Strategy
+        parseReadStrategy(const QVariantHash &config);
         /*! Create a new Closure that resolves to a QSqlDatabase instance ( only
             a connection name returned ) with a specific host or a vector of hosts. */
         static std::function<ConnectionName()>
@@ -5,6 +5,8 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <optional>
+
 #include "orm/connectors/connector.hpp"
 #include "orm/connectors/connectorinterface.hpp"
 
@@ -32,30 +34,37 @@ namespace Orm::Connectors
         const QVariantHash &getConnectorOptions() const override;
 
     protected:
-        /*! Set the connection transaction isolation level. */
-        static void configureIsolationLevel(const QSqlDatabase &connection,
-                                            const QVariantHash &config);
-        /*! Set the connection character set and collation. */
-        static void configureEncoding(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
+        /*! Configure the session using one set statement (isolation level, encoding,
+            timezone, and modes). */
+        static void configureSession(const QSqlDatabase &connection,
+                                     const QVariantHash &config);
+
+        /*! Get the assignment of the session transaction isolation level. */
+        static std::optional<QString>
+        isolationLevelAssignment(const QSqlDatabase &connection,
+                                 const QVariantHash &config);
+        /*! Get the transaction isolation level system variable name. */
+        static QString isolationLevelVariable(const QSqlDatabase &connection,
+                                              const QVariantHash &config);
+
+        /*! Get the assignment of the connection character set and collation. */
+        static std::optional<QString> encodingAssignment(const QVariantHash &config);
         /*! Get the collation for the configuration. */
         static QString getCollation(const QVariantHash &config);
-        /*! Set the timezone on the connection. */
-        static void configureTimezone(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
-
-        /*! Set the modes for the connection. */
-        static void setModes(const QSqlDatabase &connection,
-                             const QVariantHash &config);
-        /*! Get the query to enable strict mode. */
+        /*! Get the assignment of the timezone on the connection. */
+        static std::optional<QString> timezoneAssignment(const QVariantHash &config);
+
+        /*! Get the assignment of the modes for the connection. */
+        static std::optional<QString>
+        modesAssignment(const QSqlDatabase &connection, const QVariantHash &config);
+        /*! Get the modes to enable strict mode. */
         static QString strictMode(const QSqlDatabase &connection,
                                   const QVariantHash &config);
         /*! Get the MySQL server version. */
         static QString getMySqlVersion(const QSqlDatabase &connection,
                                        const QVariantHash &config);
-        /*! Set the custom modes on the connection. */
-        static void setCustomModes(const QSqlDatabase &connection,
-                                   const QVariantHash &config);
+        /*! Get the custom modes from the configuration. */
+        static QString customModes(const QVariantHash &config);
 
     private:
         /*! Get the MySQL server version querying the database server. */
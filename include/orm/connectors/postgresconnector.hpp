@@ -5,6 +5,8 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <optional>
+
 #include "orm/concerns/parsessearchpath.hpp"
 #include "orm/connectors/connector.hpp"
 #include "orm/connectors/connectorinterface.hpp"
@@ -36,28 +38,29 @@ namespace Orm::Connectors
         const QVariantHash &getConnectorOptions() const override;
 
     protected:
-        /*! Set the connection transaction isolation level. */
-        static void configureIsolationLevel(const QSqlDatabase &connection,
-                                            const QVariantHash &config);
-        /*! Set the connection character set and collation. */
-        static void configureEncoding(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
-        /*! Set the timezone on the connection. */
-        static void configureTimezone(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
-
-        /*! Set the 'search_path' on the database connection. */
-        static void configureSearchPath(const QSqlDatabase &connection,
-                                        const QVariantHash &config);
+        /*! Configure the session using one query (all statements at once). */
+        static void configureSession(const QSqlDatabase &connection,
+                                     const QVariantHash &config);
+
+        /*! Get the statement to set the connection transaction isolation level. */
+        static std::optional<QString>
+        isolationLevelStatement(const QVariantHash &config);
+        /*! Get the statement to set the connection character set. */
+        static std::optional<QString> encodingStatement(const QVariantHash &config);
+        /*! Get the statement to set the timezone on the connection. */
+        static std::optional<QString> timezoneStatement(const QVariantHash &config);
+
+        /*! Get the statement to set the 'search_path' on the database connection. */
+        static std::optional<QString> searchPathStatement(const QVariantHash &config);
         /*! Format the 'search_path' for the database query or DSN. */
         static QString quoteSearchPath(const QStringList &searchPath);
 
-        /*! Set an application name for the connection. */
-        static void configureApplicationName(const QSqlDatabase &connection,
-                                             const QVariantHash &config);
-        /*! Configure the synchronous_commit setting. */
-        static void configureSynchronousCommit(const QSqlDatabase &connection,
-                                               const QVariantHash &config);
+        /*! Get the statement to set an application name for the connection. */
+        static std::optional<QString>
+        applicationNameStatement(const QVariantHash &config);
+        /*! Get the statement to configure the synchronous_commit setting. */
+        static std::optional<QString>
+        synchronousCommitStatement(const QVariantHash &config);
 
     private:
         /*! The default QSqlDatabase connection options for the SQLiteConnector. */
@@ -35,6 +35,9 @@ namespace Orm::Connectors
         /*! Set the connection foreign key constraints. */
         static void configureForeignKeyConstraints(const QSqlDatabase &connection,
                                                    const QVariantHash &config);
+        /*! Set the performance related PRAGMAs (journal_mode, synchronous, ...). */
+        static void configurePragmas(const QSqlDatabase &connection,
+                                     const QVariantHash &config);
 
     private:
         /*! Check whether the SQLite database file exists. */
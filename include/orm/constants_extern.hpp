@@ -122,6 +122,22 @@ namespace Orm::Constants
     SHAREDLIB_EXPORT extern const QString application_name;
     SHAREDLIB_EXPORT extern const QString synchronous_commit;
     SHAREDLIB_EXPORT extern const QString spatial_ref_sys;
+    SHAREDLIB_EXPORT extern const QString prepared_statements_cache;
+    SHAREDLIB_EXPORT extern const QString where_in_array;
+    SHAREDLIB_EXPORT extern const QString forward_only;
+    SHAREDLIB_EXPORT extern const QString journal_mode;
+    SHAREDLIB_EXPORT extern const QString synchronous;
+    SHAREDLIB_EXPORT extern const QString cache_size;
+    SHAREDLIB_EXPORT extern const QString mmap_size;
+    SHAREDLIB_EXPORT extern const QString temp_store;
+    SHAREDLIB_EXPORT extern const QString busy_timeout;
+    SHAREDLIB_EXPORT extern const QString page_size;
+    SHAREDLIB_EXPORT extern const QString optimize_on_disconnect;
+    SHAREDLIB_EXPORT extern const QString pool_;
+    SHAREDLIB_EXPORT extern const QString read_;
+    SHAREDLIB_EXPORT extern const QString write_;
+    SHAREDLIB_EXPORT extern const QString sticky_;
+    SHAREDLIB_EXPORT extern const QString read_strategy;
 
     SHAREDLIB_EXPORT extern const QString H127001;
     SHAREDLIB_EXPORT extern const QString LOCALHOST;
@@ -129,6 +129,38 @@ namespace Orm::Constants
     synchronous_commit      = QStringLiteral("synchronous_commit");
     inline const QString
     spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    inline const QString
+    prepared_statements_cache = QStringLiteral("prepared_statements_cache");
+    inline const QString
+    where_in_array          = QStringLiteral("where_in_array");
+    inline const QString
+    forward_only            = QStringLiteral("forward_only");
+    inline const QString
+    journal_mode            = QStringLiteral("journal_mode");
+    inline const QString
+    synchronous             = QStringLiteral("synchronous");
+    inline const QString
+    cache_size              = QStringLiteral("cache_size");
+    inline const QString
+    mmap_size               = QStringLiteral("mmap_size");
+    inline const QString
+    temp_store              = QStringLiteral("temp_store");
+    inline const QString
+    busy_timeout            = QStringLiteral("busy_timeout");
+    inline const QString
+    page_size               = QStringLiteral("page_size");
+    inline const QString
+    optimize_on_disconnect  = QStringLiteral("optimize_on_disconnect");
+    inline const QString
+    pool_                   = QStringLiteral("pool");
+    inline const QString
+    read_                   = QStringLiteral("read");
+    inline const QString
+    write_                  = QStringLiteral("write");
+    inline const QString
+    sticky_                 = QStringLiteral("sticky");
+    inline const QString
+    read_strategy           = QStringLiteral("read_strategy");
 
     inline const QString H127001   = QStringLiteral("127.0.0.1");
     inline const QString LOCALHOST = QStringLiteral("localhost");
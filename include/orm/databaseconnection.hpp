@@ -15,6 +15,8 @@ TINY_SYSTEM_HEADER
 #include "orm/query/processors/processor.hpp"
 #include "orm/schema/grammars/schemagrammar.hpp"
 #include "orm/schema/schemabuilder.hpp"
+#include "orm/support/preparedstatementscache.hpp"
+#include "orm/support/readconnections.hpp"
 #include "orm/types/sqlquery.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -53,7 +55,7 @@ namespace Orm
     {
         Q_DISABLE_COPY(DatabaseConnection)
 
-        // To access shouldCountElapsed() method
+        // To access shouldCountElapsed() and shouldCountLatencies() methods
         friend Concerns::ManagesTransactions;
         /* The friend declaration doesn't affect an ABI or binary compatibility so
            wrapping it in the #ifdef is safe:
@@ -102,9 +104,13 @@ namespace Orm
         inline Query::Expression raw(QVariant &&value) const noexcept;
 
         /* Running SQL Queries */
-        /*! Run a select statement against the database. */
+        /*! Run a select statement against the database (std::nullopt for forwardOnly
+            uses the connection's forward-only mode), it's executed on a read replica
+            if the read connections are configured. */
         SqlQuery
-        select(const QString &queryString, QVector<QVariant> bindings = {});
+        select(const QString &queryString, QVector<QVariant> bindings = {},
+               std::optional<bool> forwardOnly = std::nullopt,
+               bool useReadConnection = true);
         /*! Run a select statement against the database. */
         inline SqlQuery
         selectFromWriteConnection(const QString &queryString,
@@ -137,11 +143,56 @@ namespace Orm
         /*! Run a raw, unprepared query against the database (good for DDL queries). */
         SqlQuery unprepared(const QString &queryString);
 
+        /* Prepared statements cache */
+        /*! Determine whether prepared statements are being cached. */
+        inline bool usingPreparedStatementsCache() const noexcept;
+        /*! Enable caching of prepared statements (LRU cache of the given size). */
+        DatabaseConnection &enablePreparedStatementsCache(std::size_t size);
+        /*! Disable caching of prepared statements. */
+        DatabaseConnection &disablePreparedStatementsCache();
+        /*! Remove all prepared statements from the cache. */
+        DatabaseConnection &flushPreparedStatementsCache();
+
+        /* Forward-only mode */
+        /*! Determine whether select queries are executed in the forward-only mode. */
+        inline bool isForwardOnly() const noexcept;
+        /*! Set whether select queries are executed in the forward-only mode. */
+        inline DatabaseConnection &setForwardOnly(bool value) noexcept;
+
+        /* Read/write connections */
+        /*! Set the read replicas used by the select queries. */
+        DatabaseConnection &setReadConnections(Support::ReadConnections &&connections);
+        /*! Get the read replicas used by the select queries. */
+        inline const Support::ReadConnections &getReadConnections() const noexcept;
+        /*! Determine whether the connection has read replicas. */
+        inline bool hasReadConnections() const noexcept;
+        /*! Determine whether reads use the write connection after a write
+            (until the forgetRecordModificationState() is called). */
+        inline bool isSticky() const noexcept;
+
+        /* Connection pool */
+        /*! Use the physical connection leased from the connection pool (it can't be
+            called directly, use the DB::lease()), the reopen resolver reopens and
+            configures the same physical connection after it was closed. */
+        void usePooledQtConnection(
+                const Connectors::ConnectionName &qtConnection,
+                std::function<Connectors::ConnectionName()> &&reopenResolver);
+        /*! Stop using the leased physical connection and restore the connection
+            resolver used outside of a lease. */
+        void releasePooledQtConnection();
+        /*! Determine whether the connection uses a physical connection leased from
+            the connection pool. */
+        inline bool usingPooledQtConnection() const noexcept;
+
         /* Obtain connection instance */
         /*! Get underlying database connection (QSqlDatabase). */
         QSqlDatabase getQtConnection();
         /*! Get underlying database connection without executing any reconnect logic. */
         QSqlDatabase getRawQtConnection() const;
+        /*! Get the underlying read replica database connection, the write connection
+            if there are no read connections or if the write connection should be used
+            (in the transaction or after the write in the sticky mode). */
+        QSqlDatabase getReadQtConnection();
         /*! Get the connection resolver for an underlying database connection. */
         inline const std::function<Connectors::ConnectionName()> &
         getQtConnectionResolver() const noexcept;
@@ -149,6 +200,12 @@ namespace Orm
         DatabaseConnection &setQtConnectionResolver(
                 const std::function<Connectors::ConnectionName()> &resolver);
 
+        /*! Get the time in milliseconds the last connection establishment took
+            (including the session configuration), -1 if not connected yet. */
+        inline qint64 getConnectElapsed() const noexcept;
+        /*! Get the number of times the connection was established (reconnects too). */
+        inline qint64 getConnectsCount() const noexcept;
+
         /*! Get a new QSqlQuery instance for the current connection. */
         QSqlQuery getQtQuery();
 
@@ -237,7 +294,7 @@ namespace Orm
 
         /*! Check if any records have been modified. */
         inline bool getRecordsHaveBeenModified() const;
-        /*! Indicates if any records have been modified. */
+        /*! Indicates if any records have been modified (can't be reset to false). */
         inline void recordsHaveBeenModified(bool value = true);
         /*! Reset the record modification state. */
         inline void forgetRecordModificationState();
@@ -261,6 +318,9 @@ namespace Orm
         /*! Get the default post processor instance. */
         virtual std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const = 0;
 
+        /*! Hook invoked before the underlying Qt's connection is closed. */
+        virtual void beforeDisconnect();
+
         /*! Callback type used in the run() method. */
         template<typename Return>
         using RunCallback =
@@ -270,7 +330,8 @@ namespace Orm
         template<typename Return>
         Return run(
                 const QString &queryString, QVector<QVariant> &&bindings,
-                const QString &type, const RunCallback<Return> &callback);
+                const QString &type, StatementType statementType,
+                const RunCallback<Return> &callback);
         /*! Run a SQL statement. */
         template<typename Return>
         Return runQueryCallback(
@@ -311,7 +372,17 @@ namespace Orm
 
     private:
         /*! Prepare an SQL statement and return the query object. */
-        QSqlQuery prepareQuery(const QString &queryString);
+        QSqlQuery prepareQuery(const QString &queryString, bool forwardOnly = false);
+        /*! Prepare an SQL statement on the given read replica (isn't cached). */
+        QSqlQuery prepareReadQuery(const QString &queryString, bool forwardOnly,
+                                   std::size_t readConnection);
+        /*! Pick the read replica for the next select query, std::nullopt if the write
+            connection should be used. */
+        std::optional<std::size_t> readConnectionIndex(bool useReadConnection);
+        /*! Remove the failed prepared statement from the cache. */
+        void forgetPreparedStatement(const QString &queryString);
+        /*! Initialize the prepared statements cache from the configuration. */
+        void initPreparedStatementsCache();
         /*! Get a new invalid QSqlQuery instance for the pretend. */
         inline static QSqlQuery getQtQueryForPretend();
 
@@ -333,6 +404,10 @@ namespace Orm
 
         /*! Determine if the elapsed time for queries should be counted. */
         inline bool shouldCountElapsed() const;
+        /*! Determine if statements latency histograms should be recorded. */
+        inline bool shouldCountLatencies() const;
+        /*! Determine if executed queries should be analyzed. */
+        inline bool shouldAnalyzeQueries() const;
 
         /*! Log database connected, invoked during MySQL ping. */
         void logConnected();
@@ -352,6 +427,28 @@ namespace Orm
         /*! Connection's driver name in printable format eg. QMYSQL -> MySQL. */
         std::optional<std::reference_wrapper<const QString>>
         m_driverNamePrintable = std::nullopt;
+
+        /*! Prepared statements cache (keyed by the SQL query string). */
+        std::optional<Support::PreparedStatementsCache>
+        m_preparedStatementsCache = std::nullopt;
+        /*! Determine whether select queries are executed in the forward-only mode
+            (the result can be traversed only once without buffering all rows). */
+        bool m_forwardOnly = false;
+
+        /*! The time in milliseconds the last connection establishment took. */
+        qint64 m_connectElapsed = -1;
+        /*! The number of times the connection was established. */
+        qint64 m_connectsCount = 0;
+
+        /*! The connection resolver used outside of a lease (pooled connections only). */
+        std::function<Connectors::ConnectionName()> m_unleasedQtConnectionResolver;
+        /*! Determine whether a physical connection is leased from the connection pool. */
+        bool m_usingPooledQtConnection = false;
+
+        /*! Read replicas used by the select queries. */
+        Support::ReadConnections m_readConnections;
+        /*! Determine whether reads use the write connection after a write. */
+        bool m_sticky = false;
     };
 #if defined(__GNUG__) && !defined(__clang__)
 #  pragma GCC diagnostic pop
@@ -385,8 +482,7 @@ namespace Orm
                                                   QVector<QVariant> bindings)
     {
         // This member function is used from the schema builders/post-processors only
-        // FEATURE read/write connection silverqx
-        return select(queryString, std::move(bindings)/*, false*/);
+        return select(queryString, std::move(bindings), std::nullopt, false);
     }
 
     SqlQuery
@@ -407,6 +503,52 @@ namespace Orm
         return affectingStatement(queryString, std::move(bindings));
     }
 
+    /* Prepared statements cache */
+
+    bool DatabaseConnection::usingPreparedStatementsCache() const noexcept
+    {
+        return m_preparedStatementsCache.has_value();
+    }
+
+    /* Forward-only mode */
+
+    bool DatabaseConnection::isForwardOnly() const noexcept
+    {
+        return m_forwardOnly;
+    }
+
+    DatabaseConnection &DatabaseConnection::setForwardOnly(const bool value) noexcept
+    {
+        m_forwardOnly = value;
+
+        return *this;
+    }
+
+    /* Read/write connections */
+
+    const Support::ReadConnections &
+    DatabaseConnection::getReadConnections() const noexcept
+    {
+        return m_readConnections;
+    }
+
+    bool DatabaseConnection::hasReadConnections() const noexcept
+    {
+        return !m_readConnections.isEmpty();
+    }
+
+    bool DatabaseConnection::isSticky() const noexcept
+    {
+        return m_sticky;
+    }
+
+    /* Connection pool */
+
+    bool DatabaseConnection::usingPooledQtConnection() const noexcept
+    {
+        return m_usingPooledQtConnection;
+    }
+
     /* Obtain connection instance */
 
     const std::function<Connectors::ConnectionName()> &
@@ -415,6 +557,16 @@ namespace Orm
         return m_qtConnectionResolver;
     }
 
+    qint64 DatabaseConnection::getConnectElapsed() const noexcept
+    {
+        return m_connectElapsed;
+    }
+
+    qint64 DatabaseConnection::getConnectsCount() const noexcept
+    {
+        return m_connectsCount;
+    }
+
     bool DatabaseConnection::isOpen()
     {
         return m_qtConnection && getQtConnection().isOpen();
@@ -500,7 +652,10 @@ namespace Orm
 
     void DatabaseConnection::recordsHaveBeenModified(const bool value)
     {
-        m_recordsModified = value;
+        /* Latched, a following statement that doesn't modify any records can't reset
+           it (eg. 0 rows updated), use the forgetRecordModificationState(). */
+        if (!m_recordsModified)
+            m_recordsModified = value;
     }
 
     void DatabaseConnection::forgetRecordModificationState()
@@ -514,15 +669,18 @@ namespace Orm
     Return
     DatabaseConnection::run(
             const QString &queryString, QVector<QVariant> &&bindings,
-            const QString &type, const RunCallback<Return> &callback)
+            const QString &type, const StatementType statementType,
+            const RunCallback<Return> &callback)
     {
         reconnectIfMissingConnection();
 
         // Elapsed timer needed
         const auto countElapsed = shouldCountElapsed();
+        const auto countLatency = shouldCountLatencies();
+        const auto analyzeQuery = shouldAnalyzeQueries();
 
         QElapsedTimer timer;
-        if (countElapsed)
+        if (countElapsed || countLatency || analyzeQuery)
             timer.start();
 
         Return result;
@@ -543,6 +701,18 @@ namespace Orm
                                           queryString, preparedBindings, callback);
         }
 
+        if (countLatency || analyzeQuery) {
+            const auto nsecs = timer.nsecsElapsed();
+
+            // Statements latency histograms
+            if (countLatency)
+                hitLatencyHistogram(queryString, statementType, nsecs);
+
+            // Slow queries and the N+1 problem
+            if (analyzeQuery)
+                this->analyzeQuery(queryString, preparedBindings, statementType, nsecs);
+        }
+
         std::optional<qint64> elapsed;
         if (countElapsed) {
             // Hit elapsed timer
@@ -622,6 +792,16 @@ namespace Orm
         return !m_pretending && (m_debugSql || m_countingElapsed);
     }
 
+    bool DatabaseConnection::shouldCountLatencies() const
+    {
+        return !m_pretending && m_countingLatencies;
+    }
+
+    bool DatabaseConnection::shouldAnalyzeQueries() const
+    {
+        return !m_pretending && m_queryAnalyzer.has_value();
+    }
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
@@ -5,8 +5,12 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <mutex>
+#include <unordered_map>
+
 #include "orm/connectionresolverinterface.hpp"
 #include "orm/query/querybuilder.hpp" // IWYU pragma: export
+#include "orm/support/connectionlease.hpp"
 #include "orm/support/databaseconfiguration.hpp"
 #include "orm/support/databaseconnectionsmap.hpp"
 
@@ -18,6 +22,10 @@ namespace Query
 {
     class Builder;
 }
+namespace Support
+{
+    class ConnectionPool;
+}
 
     /*! Database manager. */
     class SHAREDLIB_EXPORT DatabaseManager final : public ConnectionResolverInterface
@@ -174,6 +182,14 @@ namespace Query
             to be called before querying a database. */
         void connectEagerly(const QString &name = "");
 
+        /* Connection pool */
+        /*! Lease a physical connection from the connection pool to the current thread
+            for the lifetime of the returned lease (pooled connections only). */
+        Support::ConnectionLease lease(const QString &connection = "");
+        /*! Get the connection pool for the given connection (pooled connections only). */
+        std::shared_ptr<Support::ConnectionPool>
+        connectionPool(const QString &connection = "");
+
         /*! Returns a list containing the names of all connections. */
         QStringList connectionNames() const;
         /*! Returns a list containing the names of opened connections. */
@@ -357,6 +373,36 @@ namespace Query
         /*! Reset the number of executed queries on given connections. */
         void resetStatementCounters(const QStringList &connections);
 
+        /* Statements latency histograms */
+        /*! Determine whether we're recording statements latency histograms. */
+        bool countingLatencies(const QString &connection = "");
+        /*! Enable recording statements latency histograms on the current connection. */
+        DatabaseConnection &enableLatencyHistograms(const QString &connection = "");
+        /*! Disable recording statements latency histograms on the current connection. */
+        DatabaseConnection &disableLatencyHistograms(const QString &connection = "");
+        /*! Obtain statements latency histograms, ordered by the total execution time. */
+        std::vector<StatementLatency>
+        getLatencyHistograms(const QString &connection = "");
+        /*! Obtain and reset statements latency histograms. */
+        std::vector<StatementLatency>
+        takeLatencyHistograms(const QString &connection = "");
+        /*! Reset statements latency histograms. */
+        DatabaseConnection &resetLatencyHistograms(const QString &connection = "");
+
+        /*! Enable recording statements latency histograms on all connections. */
+        void enableAllLatencyHistograms();
+        /*! Disable recording statements latency histograms on all connections. */
+        void disableAllLatencyHistograms();
+        /*! Obtain statements latency histograms from all active connections of
+            the current thread merged by the fingerprint. */
+        std::vector<StatementLatency> getAllLatencyHistograms();
+        /*! Obtain and reset statements latency histograms on all active connections
+            of the current thread merged by the fingerprint. */
+        std::vector<StatementLatency> takeAllLatencyHistograms();
+        /*! Reset statements latency histograms on all active connections of
+            the current thread. */
+        void resetAllLatencyHistograms();
+
     private:
         /*! Private constructor to create DatabaseManager instance and set a default
             connection at once. */
@@ -407,6 +453,10 @@ namespace Query
         Support::DatabaseConnectionsMap m_connections {};
         /*! The callback to be executed to reconnect to a database. */
         ReconnectorType m_reconnector = nullptr;
+        /*! Connection pools shared by all threads (keyed by the connection name). */
+        std::unordered_map<QString, std::shared_ptr<Support::ConnectionPool>> m_pools;
+        /*! Mutex protecting the connection pools map. */
+        std::mutex m_poolsMutex;
 
         /*! Shared pointer to the DatabaseManager instance. */
         static std::shared_ptr<DatabaseManager> m_instance;
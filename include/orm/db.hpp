@@ -166,6 +166,14 @@ namespace Orm
             to be called before querying a database. */
         static void connectEagerly(const QString &name = "");
 
+        /* Connection pool */
+        /*! Lease a physical connection from the connection pool to the current thread
+            for the lifetime of the returned lease (pooled connections only). */
+        static Support::ConnectionLease lease(const QString &connection = "");
+        /*! Get the connection pool for the given connection (pooled connections only). */
+        static std::shared_ptr<Support::ConnectionPool>
+        connectionPool(const QString &connection = "");
+
         /*! Returns a list containing the names of all connections. */
         static QStringList connectionNames();
         /*! Returns a list containing the names of opened connections. */
@@ -355,6 +363,39 @@ namespace Orm
         /*! Reset the number of executed queries on given connections. */
         static void resetStatementCounters(const QStringList &connections);
 
+        /* Statements latency histograms */
+        /*! Determine whether we're recording statements latency histograms. */
+        static bool countingLatencies(const QString &connection = "");
+        /*! Enable recording statements latency histograms on the current connection. */
+        static DatabaseConnection &
+        enableLatencyHistograms(const QString &connection = "");
+        /*! Disable recording statements latency histograms on the current connection. */
+        static DatabaseConnection &
+        disableLatencyHistograms(const QString &connection = "");
+        /*! Obtain statements latency histograms, ordered by the total execution time. */
+        static std::vector<StatementLatency>
+        getLatencyHistograms(const QString &connection = "");
+        /*! Obtain and reset statements latency histograms. */
+        static std::vector<StatementLatency>
+        takeLatencyHistograms(const QString &connection = "");
+        /*! Reset statements latency histograms. */
+        static DatabaseConnection &
+        resetLatencyHistograms(const QString &connection = "");
+
+        /*! Enable recording statements latency histograms on all connections. */
+        static void enableAllLatencyHistograms();
+        /*! Disable recording statements latency histograms on all connections. */
+        static void disableAllLatencyHistograms();
+        /*! Obtain statements latency histograms from all active connections of
+            the current thread merged by the fingerprint. */
+        static std::vector<StatementLatency> getAllLatencyHistograms();
+        /*! Obtain and reset statements latency histograms on all active connections
+            of the current thread merged by the fingerprint. */
+        static std::vector<StatementLatency> takeAllLatencyHistograms();
+        /*! Reset statements latency histograms on all active connections of
+            the current thread. */
+        static void resetAllLatencyHistograms();
+
     private:
         /*! Get a reference to the DatabaseManager. */
         static DatabaseManager &manager();
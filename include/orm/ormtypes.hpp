@@ -53,9 +53,6 @@ namespace Query
         UNIONORDER,
     };
 
-    /*! Type for the query value bindings. */
-    using BindingsMap = QMap<BindingType, QVector<QVariant>>;
-
     /*! Aggregate item. */
     struct AggregateItem
     {
@@ -0,0 +1,224 @@
+#pragma once
+#ifndef ORM_QUERY_CURSOR_HPP
+#define ORM_QUERY_CURSOR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <variant>
+
+#include "orm/types/sqlquery.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Query
+{
+
+    /*! Lazy input range over the forward-only query result that reads one row per
+        iteration. The SqlQuery itself is the row for the T = SqlQuery, otherwise
+        the T is hydrated from every row using the given callback. */
+    template<typename T = SqlQuery>
+    class Cursor : public std::ranges::view_interface<Cursor<T>>
+    {
+        Q_DISABLE_COPY(Cursor)
+
+        /*! Determine whether the SqlQuery itself is the row. */
+        constexpr static bool IsRowView = std::same_as<T, SqlQuery>;
+
+    public:
+        /*! Type of the row. */
+        using value_type = T;
+        /*! Callback used to hydrate the T from the current row. */
+        using HydrateCallback = std::function<T(const SqlQuery &)>;
+
+        /*! Input iterator over the query result. */
+        class iterator
+        {
+        public:
+            /*! Iterator concept (the result can be traversed only once). */
+            using iterator_concept = std::input_iterator_tag;
+            /*! Type of the row. */
+            using value_type       = T;
+            /*! Difference type. */
+            using difference_type  = std::ptrdiff_t;
+
+            /*! Default constructor. */
+            inline iterator() = default;
+            /*! Constructor. */
+            inline explicit iterator(Cursor &cursor) noexcept;
+
+            /*! Get the current row. */
+            inline T &operator*() const;
+            /*! Move to the next row. */
+            inline iterator &operator++();
+            /*! Move to the next row. */
+            inline void operator++(int);
+
+            /*! Determine whether there are no more rows. */
+            friend bool
+            operator==(const iterator &it, std::default_sentinel_t /*unused*/) noexcept
+            {
+                return it.atEnd();
+            }
+
+        private:
+            /*! Determine whether there are no more rows. */
+            inline bool atEnd() const noexcept;
+
+            /*! Pointer to the cursor that owns the query result. */
+            Cursor *m_cursor = nullptr;
+        };
+
+        /*! Constructor, the SqlQuery itself is the row. */
+        inline explicit Cursor(SqlQuery &&query) requires (IsRowView);
+        /*! Constructor, the T is hydrated from every row using the given callback. */
+        inline Cursor(SqlQuery &&query, HydrateCallback &&hydrate)
+        requires (!IsRowView);
+        /*! Default destructor. */
+        inline ~Cursor() = default;
+
+        /*! Move constructor. */
+        inline Cursor(Cursor &&) noexcept = default;
+        /*! Move assignment operator. */
+        inline Cursor &operator=(Cursor &&) noexcept = default;
+
+        /*! Get an iterator to the first row (the result can be traversed only once,
+            every next call continues from the current row). */
+        inline iterator begin();
+        /*! Get the sentinel that marks the end of the result. */
+        inline std::default_sentinel_t end() const noexcept;
+
+    private:
+        /*! Move to the next row and hydrate it. */
+        inline void next();
+        /*! Get the current row. */
+        inline T &current();
+
+        /*! The forward-only query result. */
+        SqlQuery m_query;
+        /*! Callback used to hydrate the T from the current row. */
+        HydrateCallback m_hydrate = nullptr;
+        /*! The current hydrated row (unused if the SqlQuery itself is the row). */
+        std::conditional_t<IsRowView, std::monostate, std::optional<T>> m_current {};
+
+        /*! Determine whether the first row was already fetched. */
+        bool m_started = false;
+        /*! Determine whether there are no more rows. */
+        bool m_atEnd = false;
+    };
+
+    /* Cursor::iterator */
+
+    /* public */
+
+    template<typename T>
+    Cursor<T>::iterator::iterator(Cursor &cursor) noexcept
+        : m_cursor(&cursor)
+    {}
+
+    template<typename T>
+    T &Cursor<T>::iterator::operator*() const
+    {
+        return m_cursor->current();
+    }
+
+    template<typename T>
+    typename Cursor<T>::iterator &Cursor<T>::iterator::operator++()
+    {
+        m_cursor->next();
+
+        return *this;
+    }
+
+    template<typename T>
+    void Cursor<T>::iterator::operator++(int)
+    {
+        m_cursor->next();
+    }
+
+    /* private */
+
+    template<typename T>
+    bool Cursor<T>::iterator::atEnd() const noexcept
+    {
+        return m_cursor == nullptr || m_cursor->m_atEnd;
+    }
+
+    /* Cursor */
+
+    /* public */
+
+    template<typename T>
+    Cursor<T>::Cursor(SqlQuery &&query) requires (IsRowView)
+        : m_query(std::move(query))
+    {}
+
+    template<typename T>
+    Cursor<T>::Cursor(SqlQuery &&query, HydrateCallback &&hydrate)
+    requires (!IsRowView)
+        : m_query(std::move(query))
+        , m_hydrate(std::move(hydrate))
+    {}
+
+    template<typename T>
+    typename Cursor<T>::iterator Cursor<T>::begin()
+    {
+        // Fetch the first row lazily
+        if (!m_started) {
+            m_started = true;
+
+            next();
+        }
+
+        return iterator(*this);
+    }
+
+    template<typename T>
+    std::default_sentinel_t Cursor<T>::end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+    /* private */
+
+    template<typename T>
+    void Cursor<T>::next()
+    {
+        if (m_atEnd)
+            return;
+
+        if (!m_query.next()) {
+            m_atEnd = true;
+
+            // Release the result, nothing else will be read
+            m_query.finish();
+
+            if constexpr (!IsRowView)
+                m_current.reset();
+
+            return;
+        }
+
+        if constexpr (!IsRowView)
+            m_current = std::invoke(m_hydrate, std::as_const(m_query));
+    }
+
+    template<typename T>
+    T &Cursor<T>::current()
+    {
+        if constexpr (IsRowView)
+            return m_query;
+        else
+            return *m_current;
+    }
+
+} // namespace Orm::Query
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_QUERY_CURSOR_HPP
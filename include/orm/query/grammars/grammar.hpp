@@ -6,9 +6,11 @@
 TINY_SYSTEM_HEADER
 
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "orm/basegrammar.hpp"
+#include "orm/types/bindingsmap.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -37,6 +39,10 @@ namespace Orm::Query::Grammars
         virtual QString
         compileInsert(const QueryBuilder &query,
                       const QVector<QVariantMap> &values) const;
+        /*! Compile an insert statement into SQL (multi insert with separated
+            columns). */
+        QString compileInsert(const QueryBuilder &query, const QVector<QString> &columns,
+                              const QVector<QVector<QVariant>> &values) const;
         /*! Compile an insert ignore statement into SQL. */
         virtual QString
         compileInsertOrIgnore(const QueryBuilder &query,
@@ -46,6 +52,15 @@ namespace Orm::Query::Grammars
         compileInsertGetId(const QueryBuilder &query,
                            const QVector<QVariantMap> &values,
                            const QString &sequence) const;
+        /*! Compile an insert statement into SQL that returns the generated keys of
+            all inserted rows (multi insert with separated columns). */
+        virtual QString
+        compileInsertReturning(const QueryBuilder &query,
+                               const QVector<QString> &columns,
+                               const QVector<QVector<QVariant>> &values,
+                               const QString &sequence) const;
+        /*! Determine whether the insert statement can return the generated keys. */
+        inline virtual bool supportsInsertReturning() const noexcept;
 
         /*! Compile an update statement into SQL. */
         virtual QString
@@ -55,6 +70,14 @@ namespace Orm::Query::Grammars
         prepareBindingsForUpdate(const BindingsMap &bindings,
                                  const QVector<UpdateItem> &values) const;
 
+        /*! Compile an update statement for many rows into SQL, every column is set
+            by the case expression keyed by the unique column (the query wheres are
+            compiled after the unique column constraint). */
+        QString compileUpdateBatch(const QueryBuilder &query,
+                                   const QVector<QString> &columns,
+                                   const QVector<QVector<QVariant>> &values,
+                                   const QString &uniqueBy) const;
+
         /*! Compile an "upsert" statement into SQL. */
         virtual QString
         compileUpsert(QueryBuilder &query, const QVector<QVariantMap> &values,
@@ -77,6 +100,15 @@ namespace Orm::Query::Grammars
         /*! Get the grammar specific operators. */
         virtual const std::unordered_set<QString> &getOperators() const;
 
+        /*! Get the maximum number of parameters (placeholders) in one query. */
+        inline virtual int getMaxParameters() const noexcept;
+
+        /*! Determine whether the "where in" values are bound as one array binding. */
+        inline virtual bool
+        bindsWhereInAsArray(const QVector<QVariant> &values) const noexcept;
+        /*! Convert the "where in" values to one array binding. */
+        virtual QVariant whereInArrayBinding(const QVector<QVariant> &values) const;
+
     protected:
         /*! The select component compile method and whether the component was set. */
         struct SelectComponentValue
@@ -217,15 +249,12 @@ namespace Orm::Query::Grammars
         /*! Remove the leading boolean from a statement. */
         static QString removeLeadingBoolean(QString &&statement);
 
-        /*! Flat bindings map and exclude given binding types. */
-        static QVector<std::reference_wrapper<const QVariant>>
-        flatBindingsForUpdateDelete(const BindingsMap &bindings,
-                                    const QVector<BindingType> &exclude);
-
-        /*! Compute the reserve size for the BindingsMap. */
-        static QVector<QVariant>::size_type
-        computeReserveForBindingsMap(const BindingsMap &bindings,
-                                     const QVector<BindingType> &exclude = {});
+        /*! Append the bindings of all binding types except the given binding types
+            (ranges are appended in the binding type order). */
+        static void
+        appendBindingsExcept(QVector<QVariant> &preparedBindings,
+                             const BindingsMap &bindings,
+                             std::initializer_list<BindingType> exclude);
     };
 
     /* public */
@@ -239,6 +268,24 @@ namespace Orm::Query::Grammars
         return compileInsert(query, values);
     }
 
+    bool Grammar::supportsInsertReturning() const noexcept
+    {
+        return false;
+    }
+
+    int Grammar::getMaxParameters() const noexcept
+    {
+        /* MySQL prepared statements and the PostgreSQL protocol use the 16-bit
+           parameters count. */
+        return 65535;
+    }
+
+    bool Grammar::bindsWhereInAsArray(
+            const QVector<QVariant> &/*unused*/) const noexcept
+    {
+        return false;
+    }
+
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
@@ -30,6 +30,14 @@ namespace Orm::Query::Grammars
         QString compileInsertGetId(const QueryBuilder &query,
                                    const QVector<QVariantMap> &values,
                                    const QString &sequence) const override;
+        /*! Compile an insert statement into SQL that returns the generated keys of
+            all inserted rows (multi insert with separated columns). */
+        QString compileInsertReturning(const QueryBuilder &query,
+                                       const QVector<QString> &columns,
+                                       const QVector<QVector<QVariant>> &values,
+                                       const QString &sequence) const override;
+        /*! Determine whether the insert statement can return the generated keys. */
+        inline bool supportsInsertReturning() const noexcept override;
 
         /*! Compile an update statement into SQL. */
         QString compileUpdate(QueryBuilder &query,
@@ -54,6 +62,18 @@ namespace Orm::Query::Grammars
         /*! Get the grammar specific operators. */
         const std::unordered_set<QString> &getOperators() const override;
 
+        /*! Determine whether the "where in" values are bound as one array binding. */
+        bool bindsWhereInAsArray(const QVector<QVariant> &values) const noexcept override;
+        /*! Convert the "where in" values to one array literal binding. */
+        QVariant whereInArrayBinding(const QVector<QVariant> &values) const override;
+
+        /*! Get whether the "where in" clauses are compiled as = any(?) with one array
+            binding. */
+        inline bool getWhereInAsArray() const noexcept;
+        /*! Set whether the "where in" clauses are compiled as = any(?) with one array
+            binding. */
+        PostgresGrammar &setWhereInAsArray(bool value) noexcept;
+
         /*! Compile a basic where clause. */
         QString whereBasic(const WhereConditionItem &where) const;
 
@@ -66,6 +86,11 @@ namespace Orm::Query::Grammars
         /*! Compile the "select *" portion of the query. */
         QString compileColumns(const QueryBuilder &query) const override;
 
+        /*! Compile a "where in" clause. */
+        QString whereIn(const WhereConditionItem &where) const;
+        /*! Compile a "where not in" clause. */
+        QString whereNotIn(const WhereConditionItem &where) const;
+
         /*! Compile a "where date" clause. */
         QString whereDate(const WhereConditionItem &where) const;
         /*! Compile a "where time" clause. */
@@ -84,8 +109,28 @@ namespace Orm::Query::Grammars
 
         /*! Compile a delete statement with joins or limit into SQL. */
         QString compileDeleteWithJoinsOrLimit(QueryBuilder &query) const;
+
+        /*! Determine whether the value can be an element of the array literal. */
+        static bool isArrayElement(const QVariant &value);
+        /*! Convert the value to the array literal element. */
+        static QString toArrayElement(const QVariant &value);
+
+        /*! Compile the "where in" clauses as = any(?) with one array binding. */
+        bool m_whereInAsArray = false;
     };
 
+    /* public */
+
+    bool PostgresGrammar::supportsInsertReturning() const noexcept
+    {
+        return true;
+    }
+
+    bool PostgresGrammar::getWhereInAsArray() const noexcept
+    {
+        return m_whereInAsArray;
+    }
+
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
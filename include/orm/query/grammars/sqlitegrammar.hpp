@@ -50,6 +50,9 @@ namespace Orm::Query::Grammars
         /*! Get the grammar specific operators. */
         const std::unordered_set<QString> &getOperators() const override;
 
+        /*! Get the maximum number of parameters (placeholders) in one query. */
+        inline int getMaxParameters() const noexcept override;
+
     protected:
         /*! Map the ComponentType to a Grammar::compileXx() methods. */
         const QVector<SelectComponentValue> &getCompileMap() const override;
@@ -85,6 +88,15 @@ namespace Orm::Query::Grammars
         QString compileDeleteWithJoinsOrLimit(QueryBuilder &query) const;
     };
 
+    /* public */
+
+    int SQLiteGrammar::getMaxParameters() const noexcept
+    {
+        /* The SQLITE_MAX_VARIABLE_NUMBER default value is 32766 since the SQLite
+           v3.32.0, but it was 999 before and it can be lowered at compile time. */
+        return 999;
+    }
+
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
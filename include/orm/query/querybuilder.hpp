@@ -6,6 +6,7 @@
 TINY_SYSTEM_HEADER
 
 #include "orm/query/concerns/buildsqueries.hpp"
+#include "orm/query/cursor.hpp"
 #include "orm/query/grammars/grammar.hpp"
 #include "orm/utils/query.hpp"
 
@@ -69,6 +70,9 @@ namespace Orm::Query
         /* Retrieving results */
         /*! Execute the query as a "select" statement. */
         SqlQuery get(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a forward-only "select" statement and get a lazy
+            cursor over the rows (only the current row is held in the memory). */
+        Cursor<> cursor(const QVector<Column> &columns = {ASTERISK});
         /*! Execute a query for a single record by ID. */
         SqlQuery find(const QVariant &id, const QVector<Column> &columns = {ASTERISK});
 
@@ -120,9 +124,19 @@ namespace Orm::Query
         /*! Insert new records into the database (multi insert with separated columns). */
         std::optional<SqlQuery>
         insert(const QVector<QString> &columns, const QVector<QVector<QVariant>> &values);
+        /*! Insert new records into the database in batches sized to the grammar's
+            parameters limit, returns the number of inserted rows. */
+        qint64 insertBatched(const QVector<QString> &columns,
+                             const QVector<QVector<QVariant>> &values,
+                             bool transaction = false);
 
         /*! Insert a new record and get the value of the primary key. */
         quint64 insertGetId(const QVariantMap &values, const QString &sequence = "");
+        /*! Insert new records in batches and get the values of their primary keys
+            in the order returned by the returning clause. */
+        QVector<QVariant> insertGetIds(const QVector<QString> &columns,
+                                       const QVector<QVector<QVariant>> &values,
+                                       const QString &sequence = "");
 
         /*! Insert new records into the database while ignoring errors. */
         std::tuple<int, std::optional<QSqlQuery>>
@@ -138,6 +152,12 @@ namespace Orm::Query
         /*! Update records in the database. */
         std::tuple<int, QSqlQuery>
         update(const QVector<UpdateItem> &values);
+        /*! Update many records with different values in batches, the rows are
+            matched by the unique column and the query wheres, returns the number
+            of updated rows (joins are not supported). */
+        qint64 updateBatch(const QVector<QString> &columns,
+                           const QVector<QVector<QVariant>> &values,
+                           const QString &uniqueBy);
         /*! Insert or update a record matching the attributes, and fill it with values. */
         std::tuple<int, std::optional<QSqlQuery>>
         updateOrInsert(const QVector<WhereItem> &attributes,
@@ -715,6 +735,20 @@ namespace Orm::Query
         /*! Lock the selected rows in the table. */
         Builder &lock(QString &&value);
 
+        /* Forward-only mode */
+        /*! Execute the select query in the forward-only mode (the result is streamed
+            and can be traversed only once), overrides the connection's mode. */
+        Builder &forwardOnly(bool value = true);
+        /*! Determine whether the select query will be executed in the forward-only
+            mode. */
+        bool isForwardOnly() const;
+
+        /* Read/write connections */
+        /*! Use the write connection for the select query (instead of a read replica). */
+        Builder &useWriteConnection(bool value = true);
+        /*! Determine whether the select query will use the write connection. */
+        inline bool usingWriteConnection() const noexcept;
+
         /* Debugging */
         /*! Dump the current SQL and bindings. */
         void dump(bool replaceBindings = true, bool simpleBindings = false);
@@ -736,7 +770,7 @@ namespace Orm::Query
 
         /*! Get the current query value bindings as flattened QVector. */
         QVector<QVariant> getBindings() const;
-        /*! Get the raw map of bindings. */
+        /*! Get the raw bindings (ranges for every binding type). */
         inline const BindingsMap &getRawBindings() const noexcept;
         /*! Add a binding to the query. */
         Builder &addBinding(const QVariant &binding,
@@ -825,7 +859,7 @@ namespace Orm::Query
             COLUMNS,
         };
 
-        /*! Clone the query. */
+        /*! Clone the query (query parts are implicitly shared until changed). */
         inline Builder clone() const;
         /*! Clone the query without the given properties. */
         Builder cloneWithout(const std::unordered_set<PropertyType> &properties) const;
@@ -908,7 +942,13 @@ namespace Orm::Query
 
     private:
         /*! Run the query as a "select" statement against the connection. */
-        SqlQuery runSelect();
+        SqlQuery runSelect(std::optional<bool> forwardOnly = std::nullopt);
+        /*! Execute the query as a scrollable "select" statement, ignores the forward-only
+            mode (used by methods that have to count or seek the result). */
+        SqlQuery getScrollable(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a forward-only "select" statement, ignores the query's
+            and connection's forward-only mode (used by the cursors). */
+        SqlQuery getForwardOnly(const QVector<Column> &columns = {ASTERISK});
 
         /*! Set the table which the query is targeting. */
         inline Builder &setFrom(const FromClause &from);
@@ -940,6 +980,11 @@ namespace Orm::Query
                 const Column &column, const QString &comparison, QVariant value,
                 const QString &condition, WhereType type = WhereType::BASIC);
 
+        /*! Insert new records or update the existing ones in batches, common code. */
+        std::tuple<int, std::optional<QSqlQuery>>
+        upsertInternal(const QVector<QVariantMap> &values, const QStringList &uniqueBy,
+                       const QStringList &update);
+
         /*! Throw exception when m_bindings doesn't contain a passed type. */
         void checkBindingType(BindingType type) const;
 
@@ -951,19 +996,8 @@ namespace Orm::Query
         /*! The database query grammar instance. */
         std::shared_ptr<QueryGrammar> m_grammar;
 
-        /*! The current query value bindings.
-            Order is crucial here because of that QMap with an enum struct is used. */
-        BindingsMap m_bindings {
-            {BindingType::SELECT,     {}},
-            {BindingType::FROM,       {}},
-            {BindingType::JOIN,       {}},
-            {BindingType::WHERE,      {}},
-            {BindingType::GROUPBY,    {}},
-            {BindingType::HAVING,     {}},
-            {BindingType::ORDER,      {}},
-            {BindingType::UNION,      {}},
-            {BindingType::UNIONORDER, {}},
-        };
+        /*! The current query value bindings (ordered by the binding type). */
+        BindingsMap m_bindings;
 
         /*! An aggregate function and column to be run. */
         std::optional<AggregateItem> m_aggregate = std::nullopt;
@@ -989,6 +1023,11 @@ namespace Orm::Query
         qint64 m_offset = -1;
         /*! Indicates whether row locking is being used. */
         std::variant<std::monostate, bool, QString> m_lock {};
+        /*! Indicates whether the forward-only mode is being used, std::nullopt to use
+            the connection's forward-only mode. */
+        std::optional<bool> m_forwardOnly = std::nullopt;
+        /*! Indicates whether the select query uses the write connection. */
+        bool m_useWriteConnection = false;
     };
 
     /* public */
@@ -1038,10 +1077,6 @@ namespace Orm::Query
            the results and get the exact data that was requested for the query. */
         auto query = get({column, key});
 
-        // Empty result
-        if (QueryUtils::queryResultSize(query) == 0)
-            return {};
-
         /* If the column is qualified with a table or have an alias, we cannot use
            those directly in the "pluck" operations, we have to strip the table out or
            use the alias name instead. */
@@ -1770,6 +1805,11 @@ namespace Orm::Query
         return m_lock;
     }
 
+    bool Builder::usingWriteConnection() const noexcept
+    {
+        return m_useWriteConnection;
+    }
+
     Builder Builder::clone() const
     {
         return *this;
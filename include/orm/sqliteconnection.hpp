@@ -52,6 +52,9 @@ namespace Orm
         std::unique_ptr<SchemaBuilder> getDefaultSchemaBuilder() final;
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
+
+        /*! Run the PRAGMA optimize before the connection is closed if enabled. */
+        void beforeDisconnect() final;
     };
 
     /* public */
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef ORM_SUPPORT_CONNECTIONLEASE_HPP
+#define ORM_SUPPORT_CONNECTIONLEASE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <memory>
+
+#include "orm/connectors/connectorinterface.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+    class DatabaseConnection;
+
+namespace Support
+{
+    class ConnectionPool;
+
+    /*! Physical connection leased from the connection pool to the current thread,
+        the connection is returned to the pool when the lease is destroyed. Nested
+        leases on the same connection don't lease another physical connection. */
+    class SHAREDLIB_EXPORT ConnectionLease
+    {
+        Q_DISABLE_COPY(ConnectionLease)
+
+    public:
+        /*! Constructor, leases a physical connection for the given connection. */
+        ConnectionLease(std::shared_ptr<ConnectionPool> pool,
+                        DatabaseConnection &connection);
+        /*! Destructor, returns the physical connection to the pool. */
+        ~ConnectionLease();
+
+        /*! Move constructor. */
+        ConnectionLease(ConnectionLease &&other) noexcept;
+        /*! Move assignment operator. */
+        ConnectionLease &operator=(ConnectionLease &&other) noexcept;
+
+        /*! Return the physical connection to the pool before the lease is destroyed
+            (an active transaction is rolled back). */
+        void release();
+
+        /*! Determine whether the lease holds a physical connection (false for nested
+            or released leases). */
+        inline bool isActive() const noexcept;
+        /*! Get the leased QSqlDatabase connection name. */
+        inline const Connectors::ConnectionName &getQtConnectionName() const noexcept;
+
+    private:
+        /*! Lease a healthy physical connection from the pool. */
+        void acquire();
+        /*! Determine whether the leased physical connection is still usable. */
+        bool isHealthy() const;
+
+        /*! The connection pool the physical connection is leased from. */
+        std::shared_ptr<ConnectionPool> m_pool;
+        /*! The connection that uses the leased physical connection. */
+        DatabaseConnection *m_connection;
+        /*! The leased QSqlDatabase connection name. */
+        Connectors::ConnectionName m_qtConnection;
+    };
+
+    /* public */
+
+    bool ConnectionLease::isActive() const noexcept
+    {
+        return static_cast<bool>(m_pool);
+    }
+
+    const Connectors::ConnectionName &
+    ConnectionLease::getQtConnectionName() const noexcept
+    {
+        return m_qtConnection;
+    }
+
+} // namespace Support
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_CONNECTIONLEASE_HPP
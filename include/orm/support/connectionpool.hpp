@@ -0,0 +1,179 @@
+#pragma once
+#ifndef ORM_SUPPORT_CONNECTIONPOOL_HPP
+#define ORM_SUPPORT_CONNECTIONPOOL_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlDatabase>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "orm/connectors/connectorinterface.hpp"
+#include "orm/macros/export.hpp"
+#include "orm/types/connectionpoolstats.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Pool of physical database connections shared by all threads. A physical
+        connection is leased to one thread at a time (see the ConnectionLease), idle
+        connections are moved out of the thread so any thread can lease them
+        (the QSqlDatabase::moveToThread() is needed, so Qt >=6.8 is required). */
+    class SHAREDLIB_EXPORT ConnectionPool
+    {
+        Q_DISABLE_COPY_MOVE(ConnectionPool)
+
+        /*! Alias for the clock used to measure the wait and idle times. */
+        using Clock = std::chrono::steady_clock;
+
+    public:
+        /*! Acquired physical connection. */
+        struct AcquiredConnection
+        {
+            /*! The QSqlDatabase connection name. */
+            Connectors::ConnectionName name;
+            /*! Determine whether the connection was idle longer than the ping interval
+                and should be health-checked before it's used. */
+            bool shouldPing;
+        };
+
+        /*! Constructor, the config is the parsed connection configuration (it must
+            contain the 'pool' option). */
+        ConnectionPool(QString connection, QVariantHash config);
+        /*! Destructor, closes all idle connections. */
+        ~ConnectionPool();
+
+        /*! Acquire a physical connection for the current thread, waits for a released
+            connection up to the acquire timeout if the pool is full. */
+        AcquiredConnection acquire();
+        /*! Return the physical connection leased by the current thread to the pool. */
+        void release(const Connectors::ConnectionName &qtConnection);
+        /*! Close the broken physical connection leased by the current thread. */
+        void discard(const Connectors::ConnectionName &qtConnection,
+                     bool failedHealthCheck = false);
+
+        /*! Close idle connections above the minimum size that were idle longer than
+            the idle timeout, return the number of closed connections. */
+        std::size_t evictIdle();
+
+        /*! Get the connection pool statistics. */
+        ConnectionPoolStats stats() const;
+
+        /*! Get the connection name the pool belongs to. */
+        inline const QString &getName() const noexcept;
+        /*! Get the minimum number of physical connections kept open. */
+        inline std::size_t minSize() const noexcept;
+        /*! Get the maximum number of physical connections. */
+        inline std::size_t maxSize() const noexcept;
+
+        /*! Get the connection resolver that reopens the leased physical connection
+            and configures its session (after the disconnect or lost connection). */
+        std::function<Connectors::ConnectionName()>
+        reopenResolver(const Connectors::ConnectionName &qtConnection) const;
+
+        /*! Get the connection resolver used outside of a lease, it throws because
+            a pooled connection can't open a physical connection by itself. */
+        static std::function<Connectors::ConnectionName()>
+        unleasedResolver(const QString &connection);
+
+    private:
+        /*! Idle physical connection (without a thread affinity). */
+        struct IdleConnection
+        {
+            /*! The QSqlDatabase connection name. */
+            Connectors::ConnectionName name;
+            /*! The QSqlDatabase connection. */
+            QSqlDatabase database;
+            /*! The time the connection was released. */
+            Clock::time_point idleSince;
+        };
+
+        /*! Parse and validate the 'pool' configuration option. */
+        void parseConfiguration();
+
+        /*! Get the total number of physical connections (the lock must be held). */
+        inline std::size_t sizeInternal() const noexcept;
+        /*! Remove expired idle connections from the pool (the lock must be held). */
+        std::vector<IdleConnection> takeExpiredIdle();
+
+        /*! Open a new physical connection in the current thread. */
+        QSqlDatabase openConnection(const Connectors::ConnectionName &qtConnection) const;
+        /*! Close and remove the physical connection (pulls it to the current thread
+            if it doesn't have a thread affinity). */
+        static void closeConnection(const Connectors::ConnectionName &qtConnection,
+                                    QSqlDatabase &&database);
+        /*! Close and remove all the given idle physical connections. */
+        static void closeIdleConnections(std::vector<IdleConnection> &&connections);
+
+        /*! Record the time spent waiting for a connection (the lock must be held). */
+        void recordWaitTime(Clock::time_point waitStart, bool waited);
+
+        /*! The connection name the pool belongs to. */
+        QString m_connection;
+        /*! The parsed connection configuration used to open physical connections. */
+        QVariantHash m_config;
+
+        /*! Minimum number of physical connections kept open. */
+        std::size_t m_minSize = 0;
+        /*! Maximum number of physical connections. */
+        std::size_t m_maxSize = 10;
+        /*! Maximum time to wait for a released connection. */
+        std::chrono::milliseconds m_acquireTimeout {10'000};
+        /*! Idle connections above the minimum size are closed after this time. */
+        std::chrono::milliseconds m_idleTimeout {600'000};
+        /*! Idle connections are health-checked after this time. */
+        std::chrono::milliseconds m_pingInterval {30'000};
+
+        /*! Mutex protecting all data members below. */
+        mutable std::mutex m_mutex;
+        /*! Signalled when a connection is released or closed. */
+        std::condition_variable m_released;
+        /*! Idle connections, the most recently released is at the back. */
+        std::vector<IdleConnection> m_idle;
+        /*! Leased connections keyed by the QSqlDatabase connection name. */
+        std::unordered_map<QString, QSqlDatabase> m_leased;
+        /*! Number of connections being opened. */
+        std::size_t m_opening = 0;
+        /*! Sequence used to generate the QSqlDatabase connection names. */
+        quint64 m_nextId = 0;
+        /*! Statistics counters. */
+        ConnectionPoolStats m_stats {};
+    };
+
+    /* public */
+
+    const QString &ConnectionPool::getName() const noexcept
+    {
+        return m_connection;
+    }
+
+    std::size_t ConnectionPool::minSize() const noexcept
+    {
+        return m_minSize;
+    }
+
+    std::size_t ConnectionPool::maxSize() const noexcept
+    {
+        return m_maxSize;
+    }
+
+    /* private */
+
+    std::size_t ConnectionPool::sizeInternal() const noexcept
+    {
+        return m_idle.size() + m_leased.size() + m_opening;
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_CONNECTIONPOOL_HPP
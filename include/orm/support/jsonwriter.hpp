@@ -0,0 +1,115 @@
+#pragma once
+#ifndef ORM_SUPPORT_JSONWRITER_HPP
+#define ORM_SUPPORT_JSONWRITER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QJsonDocument>
+
+#include <vector>
+
+#include "orm/macros/export.hpp"
+
+class QIODevice;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Streaming JSON writer, writes the UTF-8 JSON directly to the QByteArray
+        or QIODevice sink without building the QJsonObject/QJsonArray tree, values
+        are converted the same way as the QJsonValue::fromVariant() converts them. */
+    class SHAREDLIB_EXPORT JsonWriter
+    {
+        Q_DISABLE_COPY_MOVE(JsonWriter)
+
+    public:
+        /*! Constructor, appends the JSON to the given buffer. */
+        explicit JsonWriter(QByteArray &buffer,
+                            QJsonDocument::JsonFormat format = QJsonDocument::Compact);
+        /*! Constructor, writes the JSON to the given device (buffered). */
+        explicit JsonWriter(QIODevice &device,
+                            QJsonDocument::JsonFormat format = QJsonDocument::Compact);
+        /*! Destructor, flushes the buffered JSON to the device. */
+        ~JsonWriter();
+
+        /*! Begin a new JSON object. */
+        void beginObject();
+        /*! End the current JSON object. */
+        void endObject();
+        /*! Begin a new JSON array. */
+        void beginArray();
+        /*! End the current JSON array. */
+        void endArray();
+
+        /*! Write the key of the next object member. */
+        void writeKey(const QString &key);
+        /*! Write the given value (null, bool, number, string, list, or map). */
+        void writeValue(const QVariant &value);
+        /*! Write the null value. */
+        void writeNull();
+
+        /*! Write the buffered JSON to the device (no-op for the QByteArray sink). */
+        bool flush();
+
+    private:
+        /*! Write the separator and indentation before the next value. */
+        void prepareValue();
+        /*! Write the newline and indentation (indented format only). */
+        void writeIndentation();
+
+        /*! Write the given string as the quoted and escaped JSON string. */
+        void writeString(const QString &string);
+        /*! Write the given integer. */
+        void writeInteger(qint64 value);
+        /*! Write the given unsigned integer. */
+        void writeUnsignedInteger(quint64 value);
+        /*! Write the given double (null if it's not finite). */
+        void writeDouble(double value);
+        /*! Write the given literal (null, true, false) or a number. */
+        inline void writeRaw(const char *data, qsizetype size);
+
+        /*! Flush the buffer to the device if it's full. */
+        inline void flushIfFull();
+
+        /*! Number of bytes buffered before they are written to the device. */
+        constexpr static qsizetype FlushThreshold = 16384;
+
+        /*! The internal buffer used for the QIODevice sink. */
+        QByteArray m_deviceBuffer;
+        /*! The buffer the JSON is appended to. */
+        QByteArray &m_buffer;
+        /*! The device the JSON is written to (nullptr for the QByteArray sink). */
+        QIODevice *m_device = nullptr;
+        /*! Determine whether to write the indented JSON. */
+        bool m_indented;
+        /*! Determine whether the device write failed. */
+        bool m_failed = false;
+
+        /*! Determine whether the next value is the first one for every nested
+            object or array. */
+        std::vector<bool> m_first;
+        /*! Determine whether the object member key was written. */
+        bool m_afterKey = false;
+    };
+
+    /* private */
+
+    void JsonWriter::writeRaw(const char *const data, const qsizetype size)
+    {
+        m_buffer.append(data, size);
+    }
+
+    void JsonWriter::flushIfFull()
+    {
+        if (m_device != nullptr && m_buffer.size() >= FlushThreshold)
+            flush();
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_JSONWRITER_HPP
@@ -0,0 +1,104 @@
+#pragma once
+#ifndef ORM_SUPPORT_LATENCYHISTOGRAMS_HPP
+#define ORM_SUPPORT_LATENCYHISTOGRAMS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <array>
+#include <thread>
+#include <unordered_map>
+
+#include "orm/macros/export.hpp"
+#include "orm/types/statementlatency.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Statements latency histograms keyed by the normalized SQL fingerprint and
+        the statement type, every histogram has fixed buckets. It isn't thread-safe,
+        it's owned by the connection that can be used only from the thread that
+        created it. */
+    class SHAREDLIB_EXPORT LatencyHistograms
+    {
+        Q_DISABLE_COPY(LatencyHistograms)
+
+    public:
+        /*! Number of histogram buckets (power of two microseconds). */
+        constexpr static std::size_t BucketsCount = 32;
+
+        /*! Default constructor. */
+        LatencyHistograms() = default;
+        /*! Default destructor. */
+        ~LatencyHistograms() = default;
+
+        /*! Record the execution time of the given statement. */
+        void record(const QString &queryString, StatementType type, qint64 nsecs);
+
+        /*! Determine whether no statement was recorded. */
+        inline bool isEmpty() const noexcept;
+        /*! Get snapshots of all histograms, ordered by the total execution time. */
+        std::vector<StatementLatency> statements() const;
+        /*! Remove all histograms. */
+        void clear();
+
+        /*! Merge the given statements by the fingerprint and the statement type,
+            percentiles are computed from the merged histogram buckets. */
+        static std::vector<StatementLatency>
+        merge(std::vector<StatementLatency> &&statements);
+
+    private:
+        /*! Fixed-bucket histogram. */
+        struct Histogram
+        {
+            /*! Number of statements in every bucket. */
+            std::array<qint64, BucketsCount> buckets {};
+            /*! Number of recorded statements. */
+            qint64 count = 0;
+            /*! Total execution time in microseconds. */
+            qint64 totalTime = 0;
+            /*! The longest execution time in microseconds. */
+            qint64 maxTime = 0;
+        };
+
+        /*! Histograms key (fingerprint with the statement type prepended). */
+        using KeyType = QString;
+
+        /*! Get the histogram for the given statement (creates it if needed). */
+        Histogram &histogram(const QString &queryString, StatementType type);
+        /*! Compute the histogram key. */
+        static KeyType histogramKey(const QString &fingerprint, StatementType type);
+
+        /*! Get the bucket index for the given execution time in microseconds. */
+        static std::size_t bucketIndex(qint64 usecs) noexcept;
+        /*! Compute the percentiles of the given statement from its buckets. */
+        static void computePercentiles(StatementLatency &statement);
+        /*! Sort statements by the total execution time. */
+        static void sortByTotalTime(std::vector<StatementLatency> &statements);
+
+        /*! Maximum number of cached raw SQL queries (the cache is flushed if full). */
+        constexpr static std::size_t MaxQueriesCount = 1024;
+
+        /*! Histograms keyed by the statement type and the fingerprint. */
+        std::unordered_map<KeyType, Histogram> m_histograms;
+        /*! Raw SQL queries mapped to their histograms for every statement type
+            (avoids the normalization). */
+        std::array<std::unordered_map<QString, Histogram *>, 3> m_queries;
+        /*! The thread that created the histograms (the connection's thread). */
+        std::thread::id m_threadId = std::this_thread::get_id();
+    };
+
+    /* public */
+
+    bool LatencyHistograms::isEmpty() const noexcept
+    {
+        return m_histograms.empty();
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_LATENCYHISTOGRAMS_HPP
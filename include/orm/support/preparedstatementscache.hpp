@@ -0,0 +1,91 @@
+#pragma once
+#ifndef ORM_SUPPORT_PREPAREDSTATEMENTSCACHE_HPP
+#define ORM_SUPPORT_PREPAREDSTATEMENTSCACHE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlQuery>
+
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Size-bounded LRU cache of prepared QSqlQuery-ies keyed by the SQL query string.
+        The cache is owned by the DatabaseConnection so the driver is implied,
+        it's invalidated every time the underlying QSqlDatabase connection changes. */
+    class SHAREDLIB_EXPORT PreparedStatementsCache
+    {
+        Q_DISABLE_COPY(PreparedStatementsCache)
+
+    public:
+        /*! Type used for the cache size. */
+        using size_type = std::size_t;
+
+        /*! Constructor. */
+        explicit PreparedStatementsCache(size_type capacity);
+        /*! Default destructor. */
+        inline ~PreparedStatementsCache() = default;
+
+        /*! Get the prepared query for the given SQL and mark it as most recently used,
+            std::nullopt if the query isn't cached, was prepared in another
+            forward-only mode, or its result is still being iterated. */
+        std::optional<QSqlQuery> get(const QString &queryString, bool forwardOnly);
+        /*! Insert the prepared query to the cache, return true if the least recently
+            used query was evicted. */
+        bool insert(const QString &queryString, const QSqlQuery &query);
+        /*! Remove the prepared query for the given SQL from the cache. */
+        void remove(const QString &queryString);
+        /*! Remove all prepared queries from the cache. */
+        void clear();
+
+        /*! Get the number of cached prepared queries. */
+        inline size_type size() const noexcept;
+        /*! Get the maximum number of cached prepared queries. */
+        inline size_type capacity() const noexcept;
+        /*! Set the maximum number of cached prepared queries, return the number
+            of evicted prepared queries. */
+        size_type setCapacity(size_type capacity);
+
+    private:
+        /*! Type used to store the cached queries ordered from most recently used. */
+        using QueriesListType = std::list<std::pair<QString, QSqlQuery>>;
+
+        /*! Evict least recently used prepared queries above the capacity. */
+        size_type evictOverCapacity();
+
+        /*! Maximum number of cached prepared queries. */
+        size_type m_capacity;
+        /*! Cached prepared queries, the most recently used is at the front. */
+        QueriesListType m_queries;
+        /*! Map the SQL query string to the position in the m_queries list. */
+        std::unordered_map<QString, QueriesListType::iterator> m_index;
+    };
+
+    /* public */
+
+    PreparedStatementsCache::size_type
+    PreparedStatementsCache::size() const noexcept
+    {
+        return m_index.size();
+    }
+
+    PreparedStatementsCache::size_type
+    PreparedStatementsCache::capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_PREPAREDSTATEMENTSCACHE_HPP
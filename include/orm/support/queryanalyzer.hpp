@@ -0,0 +1,103 @@
+#pragma once
+#ifndef ORM_SUPPORT_QUERYANALYZER_HPP
+#define ORM_SUPPORT_QUERYANALYZER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <functional>
+
+#include "orm/macros/export.hpp"
+#include "orm/types/queryissue.hpp"
+#include "orm/types/statementlatency.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Analyzes executed queries, reports slow queries and N+1 problems (the same
+        select query executed many times in a row with different bindings). */
+    class SHAREDLIB_EXPORT QueryAnalyzer
+    {
+    public:
+        /*! Alias for the callback invoked for every found problem. */
+        using CallbackType = std::function<void(const QueryIssue &)>;
+
+        /*! Constructor. */
+        QueryAnalyzer(CallbackType &&callback, qint64 slowQueryThreshold,
+                      qint64 nPlusOneThreshold);
+
+        /*! Analyze the executed query. */
+        void analyze(const QString &connection, const QString &queryString,
+                     const QVector<QVariant> &bindings, StatementType type,
+                     qint64 nsecs);
+        /*! Forget the currently repeated query (eg. at the end of a request). */
+        void reset();
+
+        /*! Get the slow query threshold in milliseconds (0 is disabled). */
+        inline qint64 slowQueryThreshold() const noexcept;
+        /*! Get the number of repeated queries reported as the N+1 problem
+            (0 is disabled). */
+        inline qint64 nPlusOneThreshold() const noexcept;
+
+    private:
+        /*! Report the query if it exceeded the slow query threshold. */
+        void detectSlowQuery(const QString &connection, const QString &queryString,
+                             const QVector<QVariant> &bindings, qint64 nsecs);
+        /*! Count the repeated query and report it as the N+1 problem. */
+        void detectNPlusOne(const QString &connection, const QString &queryString,
+                            const QVector<QVariant> &bindings, StatementType type,
+                            qint64 nsecs);
+
+        /*! Start counting the repeated query. */
+        void startRepeating(const QVector<QVariant> &bindings, qint64 nsecs);
+        /*! Get the fingerprint of the given query (cached for the last query). */
+        QString fingerprint(const QString &queryString) const;
+
+        /*! Convert nanoseconds to milliseconds. */
+        constexpr static qint64 toMilliseconds(qint64 nsecs) noexcept;
+
+        /*! Callback invoked for every found problem. */
+        CallbackType m_callback;
+        /*! Slow query threshold in milliseconds (0 is disabled). */
+        qint64 m_slowQueryThreshold;
+        /*! Number of repeated queries reported as the N+1 problem (0 is disabled). */
+        qint64 m_nPlusOneThreshold;
+
+        /*! The last executed query. */
+        QString m_lastQuery;
+        /*! Fingerprint of the last executed query. */
+        QString m_lastFingerprint;
+        /*! Bound values of the last executed query. */
+        QVector<QVariant> m_lastBindings;
+        /*! Number of times the last query was repeated with different bindings. */
+        qint64 m_repeated = 0;
+        /*! Total execution time of the repeated queries in nanoseconds. */
+        qint64 m_repeatedTime = 0;
+    };
+
+    /* public */
+
+    qint64 QueryAnalyzer::slowQueryThreshold() const noexcept
+    {
+        return m_slowQueryThreshold;
+    }
+
+    qint64 QueryAnalyzer::nPlusOneThreshold() const noexcept
+    {
+        return m_nPlusOneThreshold;
+    }
+
+    /* private */
+
+    constexpr qint64 QueryAnalyzer::toMilliseconds(const qint64 nsecs) noexcept
+    {
+        return nsecs / 1'000'000;
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_QUERYANALYZER_HPP
@@ -0,0 +1,137 @@
+#pragma once
+#ifndef ORM_SUPPORT_READCONNECTIONS_HPP
+#define ORM_SUPPORT_READCONNECTIONS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlDatabase>
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "orm/connectors/connectorinterface.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Read replicas of the database connection, select queries are balanced between
+        them, every replica is connected lazily during its first query. */
+    class SHAREDLIB_EXPORT ReadConnections
+    {
+    public:
+        /*! Strategy used to pick the read replica for the next query. */
+        enum struct Strategy
+        {
+            /*! Use read replicas one after another. */
+            RoundRobin,
+            /*! Use the read replica with the lowest average query latency. */
+            LeastLatency,
+        };
+
+        /*! Alias for the QSqlDatabase connection resolver type. */
+        using ResolverType = std::function<Connectors::ConnectionName()>;
+
+        /*! Default constructor (no read replicas). */
+        ReadConnections() = default;
+        /*! Constructor, the resolvers register the QSqlDatabase connections under
+            the given names. */
+        ReadConnections(std::vector<ResolverType> &&resolvers,
+                        QStringList &&qtConnectionNames, Strategy strategy);
+
+        /*! Determine whether there are no read replicas. */
+        inline bool isEmpty() const noexcept;
+        /*! Get the number of read replicas. */
+        inline std::size_t size() const noexcept;
+        /*! Get the strategy used to pick the read replica. */
+        inline Strategy strategy() const noexcept;
+
+        /*! Pick the read replica for the next query. */
+        std::size_t next();
+        /*! Get the QSqlDatabase connection of the given read replica (connects lazily
+            if it isn't connected yet). */
+        QSqlDatabase connection(std::size_t index);
+
+        /*! Record the query execution time of the given read replica. */
+        void recordLatency(std::size_t index, qint64 nsecs);
+        /*! Get the average query execution time in nanoseconds of the given read
+            replica, -1 if no query was measured yet. */
+        inline double averageLatency(std::size_t index) const;
+
+        /*! Close all connected read replicas (they will be connected lazily again). */
+        void disconnect();
+
+        /*! Get the QSqlDatabase connection names of all read replicas. */
+        inline const QStringList &qtConnectionNames() const noexcept;
+
+    private:
+        /*! Read replica. */
+        struct ReadConnection
+        {
+            /*! The QSqlDatabase connection resolver. */
+            ResolverType resolver;
+            /*! The resolved QSqlDatabase connection name. */
+            std::optional<Connectors::ConnectionName> qtConnection = std::nullopt;
+            /*! The exponential moving average of the query execution time (nsecs). */
+            double averageLatency = -1.0;
+        };
+
+        /*! Pick the next read replica one after another. */
+        std::size_t nextRoundRobin() noexcept;
+        /*! Pick the read replica with the lowest average query execution time. */
+        std::size_t nextLeastLatency() noexcept;
+
+        /*! Weight of the last query execution time in the moving average. */
+        constexpr static auto LatencyWeight = 0.2;
+        /*! Every n-th query is balanced using the round-robin to refresh the average
+            execution time of slower read replicas (least-latency strategy only). */
+        constexpr static std::size_t ProbeInterval = 16;
+
+        /*! All read replicas. */
+        std::vector<ReadConnection> m_connections;
+        /*! The QSqlDatabase connection names of all read replicas. */
+        QStringList m_qtConnectionNames;
+        /*! Strategy used to pick the read replica. */
+        Strategy m_strategy = Strategy::RoundRobin;
+        /*! Index of the read replica used by the next round-robin pick. */
+        std::size_t m_nextIndex = 0;
+        /*! Number of picked read replicas. */
+        std::size_t m_picks = 0;
+    };
+
+    /* public */
+
+    bool ReadConnections::isEmpty() const noexcept
+    {
+        return m_connections.empty();
+    }
+
+    std::size_t ReadConnections::size() const noexcept
+    {
+        return m_connections.size();
+    }
+
+    ReadConnections::Strategy ReadConnections::strategy() const noexcept
+    {
+        return m_strategy;
+    }
+
+    double ReadConnections::averageLatency(const std::size_t index) const
+    {
+        return m_connections.at(index).averageLatency;
+    }
+
+    const QStringList &ReadConnections::qtConnectionNames() const noexcept
+    {
+        return m_qtConnectionNames;
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_READCONNECTIONS_HPP
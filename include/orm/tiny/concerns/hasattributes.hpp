@@ -18,9 +18,12 @@ TINY_SYSTEM_HEADER
 #include "orm/macros/likely.hpp"
 #include "orm/macros/threadlocal.hpp"
 #include "orm/ormtypes.hpp"
+#include "orm/support/jsonwriter.hpp"
 #include "orm/tiny/casts/attribute.hpp"
 #include "orm/tiny/exceptions/mutatormappingnotfounderror.hpp"
 #include "orm/tiny/macros/crtpmodelwithbase.hpp"
+#include "orm/tiny/types/attributeslayout.hpp"
+#include "orm/tiny/types/conversionplan.hpp"
 #include "orm/tiny/utils/attribute.hpp"
 #include "orm/utils/configuration.hpp"
 #include "orm/utils/helpers.hpp"
@@ -67,6 +70,10 @@ namespace Orm::Tiny::Concerns
         /*! Set a vector of model attributes. No checking is done. */
         Derived &setRawAttributes(QVector<AttributeItem> &&attributes,
                                   bool sync = false);
+        /*! Set a vector of model attributes with the already computed layout (shared
+            between models), attribute keys must be unique and match the layout. */
+        Derived &setRawAttributes(QVector<AttributeItem> &&attributes,
+                                  const AttributesLayout &layout, bool sync = false);
         /*! Sync the original attributes with the current. */
         Derived &syncOriginal();
 
@@ -225,6 +232,10 @@ namespace Orm::Tiny::Concerns
         Derived &mergeCasts(std::unordered_map<QString, CastItem> &&casts);
         /*! Reset the Type::u_casts. */
         inline Derived &resetCasts();
+#ifdef TINYORM_TESTS_CODE
+        /*! Get the number of conversion plan computations of the model type. */
+        inline static std::size_t getConversionPlanBuildsCount() noexcept;
+#endif
 
         /* QDateTime time zone */
         /*! Get the QtTimeZoneConfig for the current connection. */
@@ -241,6 +252,8 @@ namespace Orm::Tiny::Concerns
         QVariantMap attributesToMap() const;
         /*! Convert the model's attributes to the vector. */
         QVector<AttributeItem> attributesToVector() const;
+        /*! Write the model's attributes to the JSON writer (the current object). */
+        void attributesToJson(Orm::Support::JsonWriter &writer) const;
 
         /* Serialization - Appends */
         /*! Append accessor attribute to the u_appends set. */
@@ -308,6 +321,9 @@ namespace Orm::Tiny::Concerns
         /* Datetime-related */
         /*! Determine if the given attribute is a date. */
         bool isDateAttribute(const QString &key) const;
+        /*! Convert the given value to a form proper for storage on the database
+            tables (dates are formatted using the connection grammar's format). */
+        QVariant prepareAttributeForStorage(const QString &key, QVariant value) const;
 
         /*! Return a timestamp as QDateTime object. */
         QDateTime asDateTime(const QVariant &value) const;
@@ -334,6 +350,9 @@ namespace Orm::Tiny::Concerns
         QDateTime &setTimeZone(QDateTime &datetime) const;
 
         /* Casting Attributes */
+        /*! Get the cast/date conversion plan of the model type (computed once). */
+        const ConversionPlan &getConversionPlan() const;
+
         /*! Cast an attribute, convert a QVariant value. */
         QVariant castAttribute(const QString &key, const QVariant &value) const;
         /*! Get the type of cast for a model attribute. */
@@ -420,13 +439,14 @@ namespace Orm::Tiny::Concerns
         QVector<AttributeItem> m_changes;
 
         /* Don't want to use std::reference_wrapper to attributes, because if a copy
-           of the model is made, all references would be invalidated. */
+           of the model is made, all references would be invalidated. The layouts
+           are implicitly shared so copies of the model don't copy hashes. */
         /*! The model's attributes hash (for fast lookup). */
-        std::unordered_map<QString, AttributesSizeType> m_attributesHash;
+        AttributesLayout m_attributesHash;
         /*! The model attribute's original state (for fast lookup). */
-        std::unordered_map<QString, AttributesSizeType> m_originalHash;
+        AttributesLayout m_originalHash;
         /*! The changed model attributes (for fast lookup). */
-        std::unordered_map<QString, AttributesSizeType> m_changesHash;
+        AttributesLayout m_changesHash;
 
         /*! The storage format of the model's date columns. */
         T_THREAD_LOCAL
@@ -442,6 +462,17 @@ namespace Orm::Tiny::Concerns
         /*! The attributes that should be cast. */
         T_THREAD_LOCAL
         inline static std::unordered_map<QString, CastItem> u_casts;
+        /*! The revision of the u_casts, incremented when the casts change. */
+        T_THREAD_LOCAL
+        inline static std::size_t m_castsRevision = 0;
+        /*! The cast/date conversion plan of the model type. */
+        T_THREAD_LOCAL
+        inline static std::optional<ConversionPlan> m_conversionPlan = std::nullopt;
+#ifdef TINYORM_TESTS_CODE
+        /*! The number of conversion plan computations of the model type. */
+        T_THREAD_LOCAL
+        inline static std::size_t m_conversionPlanBuildsCount = 0;
+#endif
 
         /*! Determine how the QDateTime time zone will be converted. */
         mutable std::optional<QtTimeZoneConfig> m_qtTimeZone = std::nullopt;
@@ -481,6 +512,9 @@ namespace Orm::Tiny::Concerns
         /*! QMetaType used in a function definition. */
         using QMetaTypeDef  = QMetaTypeDecl;
 #endif
+        /*! Replace the Type::u_casts and invalidate the conversion plan. */
+        void replaceUserCasts(std::unordered_map<QString, CastItem> &&casts);
+
         /*! Throw if the given attribute can not be converted to the given cast type. */
         static void throwIfCanNotCastAttribute(
                     const QString &key, CastType castType, QMetaTypeDecl metaType,
@@ -566,15 +600,7 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::setAttribute(
             const QString &key, QVariant value)
     {
-        /* If an attribute is listed as a "date", we'll convert it from a DateTime
-           instance into a form proper for storage on the database tables using
-           the connection grammar's date format. We will auto set the values. */
-        if (const auto typeId = Helpers::qVariantTypeId(value);
-            value.isValid() && (isDateAttribute(key) ||
-            // NOTE api different, if the QDateTime or QDate is detected then take it as datetime silverqx
-            typeId == QMetaType::QDateTime || typeId == QMetaType::QDate)
-        )
-            value = fromDateTime(value);
+        value = prepareAttributeForStorage(key, std::move(value));
 
         // Found
         if (const auto attribute = m_attributesHash.find(key);
@@ -605,10 +631,7 @@ namespace Orm::Tiny::Concerns
         m_attributes = AttributeUtils::removeDuplicateKeys(attributes);
 
         // Build attributes hash
-        m_attributesHash.clear();
-        m_attributesHash.reserve(static_cast<std::size_t>(m_attributes.size()));
-
-        rehashAttributePositions(m_attributes, m_attributesHash);
+        m_attributesHash = AttributesLayout(m_attributes);
 
         if (sync)
             syncOriginal();
@@ -629,10 +652,30 @@ namespace Orm::Tiny::Concerns
         m_attributes = AttributeUtils::removeDuplicateKeys(std::move(attributes));
 
         // Build attributes hash
-        m_attributesHash.clear();
-        m_attributesHash.reserve(static_cast<std::size_t>(m_attributes.size()));
+        m_attributesHash = AttributesLayout(m_attributes);
 
-        rehashAttributePositions(m_attributes, m_attributesHash);
+        if (sync)
+            syncOriginal();
+
+        m_attributeMutatorsCache.clear();
+        m_modelAttributesCacheForMutators.reset();
+
+        return model();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived &
+    HasAttributes<Derived, AllRelations...>::setRawAttributes(
+            QVector<AttributeItem> &&attributes, const AttributesLayout &layout,
+            const bool sync)
+    {
+        /* The keys are already unique and match the given layout (resolved once
+           per result set), so removing duplicate keys and rehashing is skipped and
+           the layout is shared with other models. */
+        Q_ASSERT(static_cast<std::size_t>(attributes.size()) == layout.size());
+
+        m_attributes = std::move(attributes);
+        m_attributesHash = layout;
 
         if (sync)
             syncOriginal();
@@ -646,9 +689,9 @@ namespace Orm::Tiny::Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived &HasAttributes<Derived, AllRelations...>::syncOriginal()
     {
+        // Both are implicitly shared until one of them is modified
         m_original = getAttributes();
-
-        rehashAttributePositions(m_original, m_originalHash);
+        m_originalHash = m_attributesHash;
 
         return model();
     }
@@ -672,7 +715,7 @@ namespace Orm::Tiny::Concerns
         // FEATURE castable silverqx
 //        mergeAttributesFromClassCasts();
 
-        return m_attributesHash;
+        return m_attributesHash.hash();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -753,7 +796,7 @@ namespace Orm::Tiny::Concerns
             typename HasAttributes<Derived, AllRelations...>::AttributesSizeType> &
     HasAttributes<Derived, AllRelations...>::getOriginalsHash() const
     {
-        return m_originalHash;
+        return m_originalHash.hash();
     }
 
     // NOTE api different silverqx
@@ -794,7 +837,7 @@ namespace Orm::Tiny::Concerns
         m_attributesHash.erase(key);
 
         // Rehash attributes, but only attributes which were shifted
-        rehashAttributePositions(m_attributes, m_attributesHash, position);
+        m_attributesHash.rehash(m_attributes, position);
 
         /* Need to clear the mutators cache because any mutator can depend on this unset
            attribute, so the recomputation will be needed. */
@@ -819,7 +862,7 @@ namespace Orm::Tiny::Concerns
         m_attributesHash.erase(key);
 
         // Rehash attributes, but only attributes which were shifted
-        rehashAttributePositions(m_attributes, m_attributesHash, position);
+        m_attributesHash.rehash(m_attributes, position);
 
         /* Need to clear the mutators cache because any mutator can depend on this unset
            attribute, so the recomputation will be needed. */
@@ -935,7 +978,7 @@ namespace Orm::Tiny::Concerns
             typename HasAttributes<Derived, AllRelations...>::AttributesSizeType> &
     HasAttributes<Derived, AllRelations...>::getChangesHash() const
     {
-        return m_changesHash;
+        return m_changesHash.hash();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1049,17 +1092,9 @@ namespace Orm::Tiny::Concerns
            everytime false. This can be considered as a bug but it doesn't matter,
            it doesn't affect the logic in any way and the result will be correct.
            The result is that I'm still successfully avoiding the need to add
-           a separate Model initialization method, which I'm super happy with 🙌. */
-
-        if (!basemodel().usesTimestamps())
-            return Model<Derived, AllRelations...>::getUserDates();
-
-        auto dates = Model<Derived, AllRelations...>::getUserDates() +
-                     Model<Derived, AllRelations...>::timestampColumnNames();
-
-        dates.removeDuplicates();
-
-        return dates;
+           a separate Model initialization method, which I'm super happy with 🙌.
+           The conversion plan is recomputed when the u_timestamps value differs. */
+        return getConversionPlan().dates();
     }
 
     /* Model::AttributeReference - begin */
@@ -1171,34 +1206,23 @@ namespace Orm::Tiny::Concerns
     std::unordered_map<QString, CastItem>
     HasAttributes<Derived, AllRelations...>::getCasts() const
     {
-        const auto &basemodel = this->basemodel();
-
-        const auto &keyName = basemodel.getKeyName();
-
-        /* Needed to make a copy because it can interfere with the check
-           in the getAttribute() method (getUserCasts().contains(key)), so don't modify
-           the user's u_casts and add the 'id' cast on the fly on the casts copy. */
-        auto casts = basemodel.getUserCasts();
-
-        // try_emplace implies casts.contains()
-        if (basemodel.getIncrementing()/* && !casts.contains(keyName)*/)
-            // FEATURE dilemma primarykey, Model::KeyType vs QVariant silverqx
-            casts.try_emplace(keyName, CastType::ULongLong);
-
-        return casts;
+        return getConversionPlan().casts();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     bool HasAttributes<Derived, AllRelations...>::hasCast(const QString &key) const
     {
-        return getCasts().contains(key);
+        return getConversionPlan().hasCast(key);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     bool HasAttributes<Derived, AllRelations...>::hasCast(
             const QString &key, const std::unordered_set<CastType> &types) const
     {
-        return hasCast(key) && types.contains(getCastType(key));
+        const auto *const conversion = getConversionPlan().find(key);
+
+        return conversion != nullptr && conversion->cast &&
+               types.contains(conversion->cast->type());
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1206,7 +1230,19 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::mergeCasts(
             const std::unordered_map<QString, CastItem> &casts)
     {
-        auto &userCasts = basemodel().getUserCasts();
+        const auto &userCasts = basemodel().getUserCasts();
+
+        const auto isMerged = std::ranges::all_of(casts,
+                                                  [&userCasts](const auto &cast)
+        {
+            const auto itCast = userCasts.find(cast.first);
+
+            return itCast != userCasts.end() && itCast->second == cast.second;
+        });
+
+        // Nothing to do, don't invalidate the conversion plan
+        if (isMerged)
+            return model();
 
         std::remove_cvref_t<decltype (casts)> mergedCasts;
         mergedCasts.reserve(userCasts.size() + casts.size());
@@ -1216,8 +1252,7 @@ namespace Orm::Tiny::Concerns
         for (const auto &[attribute, castItem] : casts)
             mergedCasts.insert_or_assign(attribute, castItem);
 
-        // Swap user casts
-        userCasts = std::move(mergedCasts);
+        replaceUserCasts(std::move(mergedCasts));
 
         return model();
     }
@@ -1227,7 +1262,22 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::mergeCasts(
             std::unordered_map<QString, CastItem> &casts)
     {
-        basemodel().getUserCasts().merge(casts);
+        const auto &userCasts = basemodel().getUserCasts();
+
+        const auto isMerged = std::ranges::all_of(casts,
+                                                  [&userCasts](const auto &cast)
+        {
+            return userCasts.contains(cast.first);
+        });
+
+        // The merge() doesn't overwrite existing casts, nothing to do
+        if (isMerged)
+            return model();
+
+        auto mergedCasts = userCasts;
+        mergedCasts.merge(casts);
+
+        replaceUserCasts(std::move(mergedCasts));
 
         return model();
     }
@@ -1237,19 +1287,28 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::mergeCasts(
             std::unordered_map<QString, CastItem> &&casts)
     {
-        basemodel().getUserCasts().merge(std::move(casts));
-
-        return model();
+        // The casts are extracted the same way as for the lvalue
+        return mergeCasts(casts);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived &HasAttributes<Derived, AllRelations...>::resetCasts()
     {
-        basemodel().getUserCasts().clear();
+        if (!basemodel().getUserCasts().empty())
+            replaceUserCasts({});
 
         return model();
     }
 
+#ifdef TINYORM_TESTS_CODE
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::size_t
+    HasAttributes<Derived, AllRelations...>::getConversionPlanBuildsCount() noexcept
+    {
+        return m_conversionPlanBuildsCount;
+    }
+#endif
+
     /* QDateTime time zone */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1350,6 +1409,67 @@ namespace Orm::Tiny::Concerns
         return attributes;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::attributesToJson(
+            Orm::Support::JsonWriter &writer) const
+    {
+        const auto &basemodel = this->basemodel();
+        // Obtain these here to avoid obtaining them for every attribute
+        const auto &visible = basemodel.getUserVisible();
+        const auto &hidden  = basemodel.getUserHidden();
+        const auto &appends = basemodel.getUserAppends();
+        const auto &conversionPlan = getConversionPlan();
+
+        /* The same rules as for the attributesToVector() but applied in one pass, every
+           attribute is converted and written separately, so the attributes vector
+           doesn't have to be copied. */
+        for (const auto &[key, value] : getAttributes()) {
+            // Skip the keys that are in the u_appends, they will be written later
+            if ((!visible.empty() && !visible.contains(key)) || hidden.contains(key) ||
+                appends.contains(key)
+            )
+                continue;
+
+            writer.writeKey(key);
+
+            // Nothing to convert, this attribute doesn't have a cast and isn't a date
+            const auto *const conversion = conversionPlan.find(key);
+            if (conversion == nullptr) {
+                writer.writeValue(value);
+                continue;
+            }
+
+            auto serialized = value;
+            const auto &castItem = conversion->cast;
+
+            /* If an attribute is a date, we will cast it to a string after converting
+               it to a QDateTime instance, the attribute that has set the cast
+               to the QDateTime is serialized by the cast below. */
+            if (conversion->date &&
+                (!castItem || (!isDateCastType(castItem->type()) &&
+                               !isCustomDateCastType(*castItem)))
+            )
+                serialized = serialized.isNull()
+                             ? NullVariant::QDateTime()
+                             : Model<Derived, AllRelations...>::
+                               getUserSerializeDateTime(asDateTime(serialized));
+
+            // Next we will handle any cast that has been setup for this attribute
+            if (castItem)
+                castAttributeForSerialization(serialized, key, *castItem);
+
+            writer.writeValue(serialized);
+        }
+
+        /* Here we will write all of the appended, calculated attributes to this model
+           as these attributes are not really in the attributes vector, but are run
+           when we need to serialize or JSON the model for convenience to the coder. */
+        for (const auto &key : getSerializableAppends()) {
+            writer.writeKey(key);
+            writer.writeValue(mutateAccessorAttribute(key));
+        }
+    }
+
     /* Serialization - Appends */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1451,9 +1571,15 @@ namespace Orm::Tiny::Concerns
         if (!value.isValid())
             return value;
 
+        const auto *const conversion = getConversionPlan().find(key);
+
+        // Nothing to do, the attribute has no cast and isn't a date
+        if (conversion == nullptr)
+            return value;
+
         /* If the attribute exists within the u_casts hash, we will convert it to
            an appropriate QVariant type. */
-        if (hasCast(key))
+        if (conversion->cast)
             return castAttribute(key, value);
 
         /* If the attribute is listed as a date, we will convert it to the QDateTime
@@ -1463,7 +1589,7 @@ namespace Orm::Tiny::Concerns
            we need to return the null QVariant(QString) for the SQLite database, so
            the logic here is, whatever the QtSql driver returns if the QVariant is null
            we will return too. */
-        if (!value.isNull() && getDates().contains(key))
+        if (!value.isNull() && conversion->date)
             return asDateOrDateTime(value);
 
         return value;
@@ -1514,7 +1640,7 @@ namespace Orm::Tiny::Concerns
     {
         m_changes = getDirty();
 
-        rehashAttributePositions(m_changes, m_changesHash);
+        m_changesHash.rehash(m_changes);
 
         return model();
     }
@@ -1556,7 +1682,7 @@ namespace Orm::Tiny::Concerns
 
                 m_original.append({attribute, modelAttributeValue});
 
-                rehashAttributePositions(m_original, m_originalHash, rehashFrom);
+                m_originalHash.rehash(m_original, rehashFrom);
             }
         }
 
@@ -1609,9 +1735,9 @@ namespace Orm::Tiny::Concerns
             std::unordered_map<QString, AttributesSizeType> &attributesHash,
             const int from)
     {
-        /* This member function is universal and can be used for m_attributes,
-           m_changes and m_original and it associated unordered_maps m_attributesHash,
-           m_changesHash and m_originalHash. */
+        /* The m_attributesHash, m_changesHash, and m_originalHash are rehashed using
+           the AttributesLayout::rehash(), this one is used for the vectorable
+           attributes. */
         for (auto i = from; i < attributes.size(); ++i)
             // 'i' is the position index
             attributesHash[attributes.at(i).key] = i;
@@ -1639,7 +1765,25 @@ namespace Orm::Tiny::Concerns
     bool
     HasAttributes<Derived, AllRelations...>::isDateAttribute(const QString &key) const
     {
-        return getDates().contains(key) || isDateCastable(key);
+        return getConversionPlan().isDateAttribute(key);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QVariant
+    HasAttributes<Derived, AllRelations...>::prepareAttributeForStorage(
+            const QString &key, QVariant value) const
+    {
+        /* If an attribute is listed as a "date", we'll convert it from a DateTime
+           instance into a form proper for storage on the database tables using
+           the connection grammar's date format. We will auto set the values. */
+        if (const auto typeId = Helpers::qVariantTypeId(value);
+            value.isValid() && (isDateAttribute(key) ||
+            // NOTE api different, if the QDateTime or QDate is detected then take it as datetime silverqx
+            typeId == QMetaType::QDateTime || typeId == QMetaType::QDate)
+        )
+            return fromDateTime(value);
+
+        return value;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1824,6 +1968,52 @@ namespace Orm::Tiny::Concerns
 
     /* Casting Attributes */
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const ConversionPlan &
+    HasAttributes<Derived, AllRelations...>::getConversionPlan() const
+    {
+        const auto &basemodel = this->basemodel();
+
+        const auto &userDates     = Model<Derived, AllRelations...>::getUserDates();
+        const auto &keyName       = basemodel.getKeyName();
+        const auto incrementing   = basemodel.getIncrementing();
+        const auto usesTimestamps = basemodel.usesTimestamps();
+
+        // The plan is computed once per model type, recompute it if an input changed
+        if (m_conversionPlan &&
+            m_conversionPlan->isComputedFrom(userDates, m_castsRevision, keyName,
+                                             incrementing, usesTimestamps)
+        ) T_LIKELY
+            return *m_conversionPlan;
+
+        /* Don't modify the user's u_casts because it can interfere with the check
+           in the getAttribute() method (getUserCasts().contains(key)), add the 'id'
+           cast on the fly on the casts copy. */
+        auto casts = basemodel.getUserCasts();
+
+        // try_emplace implies casts.contains()
+        if (incrementing)
+            // FEATURE dilemma primarykey, Model::KeyType vs QVariant silverqx
+            casts.try_emplace(keyName, CastType::ULongLong);
+
+        auto dates = userDates;
+
+        if (usesTimestamps) {
+            dates += Model<Derived, AllRelations...>::timestampColumnNames();
+            dates.removeDuplicates();
+        }
+
+        m_conversionPlan.emplace(std::move(casts), std::move(dates),
+                                 Tiny::Types::ConversionPlanSource {
+                                     userDates, m_castsRevision, keyName, incrementing,
+                                     usesTimestamps});
+#ifdef TINYORM_TESTS_CODE
+        ++m_conversionPlanBuildsCount;
+#endif
+
+        return *m_conversionPlan;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     QVariant
     HasAttributes<Derived, AllRelations...>::castAttribute(
@@ -1952,14 +2142,14 @@ namespace Orm::Tiny::Concerns
     CastItem
     HasAttributes<Derived, AllRelations...>::getCastItem(const QString &key) const
     {
-        return getCasts().at(key);
+        return getConversionPlan().castItem(key);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     CastType
     HasAttributes<Derived, AllRelations...>::getCastType(const QString &key) const
     {
-        return getCasts().at(key).type();
+        return getConversionPlan().castItem(key).type();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -2089,7 +2279,7 @@ namespace Orm::Tiny::Concerns
     void HasAttributes<Derived, AllRelations...>::addDateAttributesToMap(
             QVariantMap &attributes) const
     {
-        for (auto &&key : getDates()) {
+        for (const auto &key : getConversionPlan().dates()) {
             // NOTE api different, Eloquent is doing a double cast silverqx
             /* Nothing to do, this attribute is not set OR it has set the cast
                to the QDateTime, in this case, skip the serialization to avoid useless
@@ -2112,7 +2302,7 @@ namespace Orm::Tiny::Concerns
             QVector<AttributeItem> &attributes,
             const std::unordered_map<QString, AttributesSizeType> &attributesHash) const
     {
-        for (auto &&key : getDates()) {
+        for (const auto &key : getConversionPlan().dates()) {
             // NOTE api different, Eloquent is doing a double cast silverqx
             /* Nothing to do, this attribute is not set OR it has set the cast
                to the QDateTime, in this case, skip the serialization to avoid useless
@@ -2134,7 +2324,7 @@ namespace Orm::Tiny::Concerns
     void HasAttributes<Derived, AllRelations...>::addCastAttributesToMap(
             QVariantMap &attributes) const
     {
-        for (auto &&[key, castItem] : getCasts()) {
+        for (const auto &[key, castItem] : getConversionPlan().casts()) {
             // Nothing to do, this attribute is not set
             if (!attributes.contains(key))
                 continue;
@@ -2154,7 +2344,7 @@ namespace Orm::Tiny::Concerns
             QVector<AttributeItem> &attributes,
             const std::unordered_map<QString, AttributesSizeType> &attributesHash) const
     {
-        for (auto &&[key, castItem] : getCasts()) {
+        for (const auto &[key, castItem] : getConversionPlan().casts()) {
             // Nothing to do, this attribute is not set
             if (!attributesHash.contains(key))
                 continue;
@@ -2285,6 +2475,16 @@ namespace Orm::Tiny::Concerns
 
     /* Casting Attributes */
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::replaceUserCasts(
+            std::unordered_map<QString, CastItem> &&casts)
+    {
+        basemodel().setUserCasts(std::move(casts));
+
+        // The conversion plan will be recomputed on the next access
+        ++m_castsRevision;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     void HasAttributes<Derived, AllRelations...>::throwIfCanNotCastAttribute(
             const QString &key, const CastType castType, QMetaTypeDef metaType,
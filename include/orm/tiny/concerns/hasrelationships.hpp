@@ -5,9 +5,13 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <unordered_set>
+
 #include <range/v3/algorithm/contains.hpp>
 
 #include "orm/exceptions/invalidtemplateargumenterror.hpp"
+#include "orm/macros/threadlocal.hpp"
+#include "orm/support/jsonwriter.hpp"
 #include "orm/tiny/concerns/hasrelationstore.hpp"
 #include "orm/tiny/exceptions/relationmappingnotfounderror.hpp"
 #include "orm/tiny/exceptions/relationnotloadederror.hpp"
@@ -16,6 +20,7 @@ TINY_SYSTEM_HEADER
 #include "orm/tiny/relations/belongstomany.hpp"
 #include "orm/tiny/relations/hasmany.hpp"
 #include "orm/tiny/relations/hasone.hpp"
+#include "orm/tiny/types/modelmetadata.hpp"
 #include "orm/utils/string.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -149,6 +154,9 @@ namespace Concerns
         /* Touching timestamps */
         /*! Touch the owning relations of the model. */
         void touchOwners() const;
+        /*! Touch the owning relations of the model, skip the owners that were
+            already touched (used to touch every owner only once). */
+        void touchOwners(std::unordered_set<QString> &touched) const;
 
         /*! Get the relationships that are touched on save. */
         inline const QStringList &getTouchedRelations() const;
@@ -251,15 +259,11 @@ namespace Concerns
         /*! Get a map of all serializable relations (visible/hidden). */
         RelationsContainer<AllRelations...> getSerializableRelations() const;
 
-        /* Others */
-        /*! Compare the u_relations hash (size and keys only). */
-        static bool compareURelations(
-                    const QHash<QString, RelationVisitor> &left,
-                    const QHash<QString, RelationVisitor> &right);
-
         /* Data members */
-        /*! Map of relation names to methods. */
-        QHash<QString, RelationVisitor> u_relations;
+        /*! Map of relation names to methods (static per Derived model so it isn't
+            copied to every model instance). */
+        T_THREAD_LOCAL
+        inline static const QHash<QString, RelationVisitor> u_relations;
 
         /* The libstdc++ shipped with the GCC <12.1 doesn't allow an incomplete
            mapped_type (value) in the std::unordered_map. */
@@ -336,11 +340,15 @@ namespace Concerns
 
         /* Touch owners store related */
         /*! Create 'touch owners relation store' and touch all related models. */
-        void touchOwnersWithVisitor(const QString &relation) const;
+        void touchOwnersWithVisitor(const QString &relation,
+                                    std::unordered_set<QString> *touched) const;
         /*! On the base of alternative held by m_relations decide, which
             touchOwnersVisited() to execute. */
         template<typename Related, typename Relation>
-        void touchOwnersVisited(Relation &&relation, const QString &relationName);
+        void touchOwnersVisited(Relation &&relation, const QString &relationName,
+                                std::unordered_set<QString> *touched);
+        /*! Get the key that identifies the owners touched by the relation query. */
+        static QString touchedOwnersKey(QueryBuilder &query);
 
         /* QueriesRelationships store related */
         /*! Create 'QueriesRelationships relation store' to obtain relation instance. */
@@ -362,6 +370,11 @@ namespace Concerns
                               const QVector<WithItem> &onlyRelations);
 
         /* Serialization - Relations */
+        /*! Serialize the model's relationships to the given map, vector, or
+            JSON writer. */
+        template<SerializedAttributes C, typename PivotType>
+        void serializeRelationsTo(C &attributes) const;
+
         /*! Create and visit the serialize relation store. */
         template<SerializedAttributes C>
         void serializeRelationWithVisitor(
@@ -392,6 +405,11 @@ namespace Concerns
         inline static void
         insertSerializedRelation(QVector<AttributeItem> &attributes, QString &&relation,
                                  QVariant &&relationSerialized);
+        /*! Write the relation key and the serialized relation to the JSON writer. */
+        template<typename Related, typename PivotType>
+        static void
+        writeSerializedRelation(Orm::Support::JsonWriter &writer, const QString &relation,
+                                const RelationsType<AllRelations...> &models);
 
         /* Serialization - HidesAttributes */
         /*! Get a relations map of visible serializable relations. */
@@ -428,7 +446,7 @@ namespace Concerns
         /*! If the relation is defined on the model, then lazy load and return results
             from the query and hydrate the relationship's value on the "relationships"
             data member m_relations. */
-        if (basemodel().getUserRelations().contains(relation))
+        if (Model<Derived, AllRelations...>::getUserRelations().contains(relation))
             return getRelationshipFromMethod<Related, Container>(relation);
 
         return {};
@@ -448,7 +466,7 @@ namespace Concerns
         /*! If the relation is defined on the model, then lazy load and return results
             from the query and hydrate the relationship's value on the "relationships"
             data member m_relations. */
-        if (basemodel().getUserRelations().contains(relation))
+        if (Model<Derived, AllRelations...>::getUserRelations().contains(relation))
             return getRelationshipFromMethod<Related, Tag>(relation);
 
         return nullptr;
@@ -720,7 +738,15 @@ namespace Concerns
     void HasRelationships<Derived, AllRelations...>::touchOwners() const
     {
         for (const auto &relation : getTouchedRelations())
-            touchOwnersWithVisitor(relation);
+            touchOwnersWithVisitor(relation, nullptr);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasRelationships<Derived, AllRelations...>::touchOwners(
+            std::unordered_set<QString> &touched) const
+    {
+        for (const auto &relation : getTouchedRelations())
+            touchOwnersWithVisitor(relation, &touched);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -816,30 +842,9 @@ namespace Concerns
     template<SerializedAttributes C, typename PivotType>
     C HasRelationships<Derived, AllRelations...>::serializeRelations() const
     {
-        const auto serializableRelations = getSerializableRelations();
-
         C attributes;
-        if constexpr (HasReserveMethod<C>)
-            attributes.reserve(static_cast<QVector<AttributeItem>::size_type>(
-                                   serializableRelations.size()));
-
-        for (const auto &[relation, models] : serializableRelations) {
-            Q_ASSERT(!models.valueless_by_exception());
 
-            // Serialize belongs-to-many relation or the pivot model
-            if constexpr (hasPivotRelation() && !std::is_void_v<PivotType>) {
-                // Pivot model, skipping the relation store, call the visited directly
-                if (m_pivots.contains(relation))
-                    serializeRelationVisited<PivotType, C, void>(relation, models,
-                                                                 attributes);
-                // belongs-to-many relation
-                else
-                    serializeRelationWithVisitor(relation, models, attributes);
-            }
-            // Serialize has-one, has-many, and belongs-to relations
-            else
-                serializeRelationWithVisitor(relation, models, attributes);
-        }
+        serializeRelationsTo<C, PivotType>(attributes);
 
         return attributes;
     }
@@ -850,13 +855,8 @@ namespace Concerns
     bool HasRelationships<Derived, AllRelations...>::operator==(
             const HasRelationships &right) const
     {
-        // u_relations == right.u_relations
-        /* It compares only the size and keys and doesn't compare hash values because
-           the std::function doesn't have a full/complete operator==() (it only compares
-           for the nullptr). */
-        if (!compareURelations(u_relations, right.u_relations))
-            return false;
-
+        /* The u_relations doesn't need to be compared, it's the static data member
+           so it's the same for all models of the same type. */
         return m_relations == right.m_relations &&
                u_touches   == right.u_touches   &&
                m_pivots    == right.m_pivots;
@@ -1024,22 +1024,28 @@ namespace Concerns
     template<typename Related>
     QString HasRelationships<Derived, AllRelations...>::pivotTableName() const
     {
-        /* The joining table name, by convention, is simply the snake_cased, models
-           sorted alphabetically and concatenated with an underscore, so we can
-           just sort the models and join them together to get the table name. */
-        QStringList segments {
-            // The table name of the current model instance
-            TypeUtils::classPureBasename<Derived>(),
-            // The table name of the related model instance
-            TypeUtils::classPureBasename<Related>(),
-        };
+        // Depends only on the model types so it's computed only once
+        static const auto cached = []
+        {
+            /* The joining table name, by convention, is simply the snake_cased, models
+               sorted alphabetically and concatenated with an underscore, so we can
+               just sort the models and join them together to get the table name. */
+            QStringList segments {
+                // The table name of the current model instance
+                ModelMetadata<Derived>::classPureBasename(),
+                // The table name of the related model instance
+                ModelMetadata<Related>::classPureBasename(),
+            };
 
-        /* Now that we have the model names in the vector, we can just sort them and
-           use the join function to join them together with an underscore,
-           which is typically used by convention within the database system. */
-        segments.sort(Qt::CaseInsensitive);
+            /* Now that we have the model names in the vector, we can just sort them
+               and use the join function to join them together with an underscore,
+               which is typically used by convention within the database system. */
+            segments.sort(Qt::CaseInsensitive);
 
-        return segments.join(UNDERSCORE).toLower();
+            return segments.join(UNDERSCORE).toLower();
+        }();
+
+        return cached;
     }
 
     /* Serialization - Relations */
@@ -1063,23 +1069,6 @@ namespace Concerns
                     hidden);
     }
 
-    /* Others */
-
-    template<typename Derived, AllRelationsConcept ...AllRelations>
-    bool HasRelationships<Derived, AllRelations...>::compareURelations(
-            const QHash<QString, RelationVisitor> &left,
-            const QHash<QString, RelationVisitor> &right)
-    {
-        if (left.size() != right.size())
-            return false;
-
-        for (auto it = right.keyBegin(); it != right.keyEnd(); ++it)
-            if (left.find(*it) == left.constEnd())
-                return false;
-
-        return true;
-    }
-
     /* private */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1088,7 +1077,7 @@ namespace Concerns
             const QString &name, const RelationFrom from) const
     {
         // Nothing to do, relation defined
-        if (basemodel().getUserRelations().contains(name))
+        if (Model<Derived, AllRelations...>::getUserRelations().contains(name))
             return;
 
         throw Exceptions::RelationMappingNotFoundError(
@@ -1196,11 +1185,7 @@ namespace Concerns
     QString
     HasRelationships<Derived, AllRelations...>::guessBelongsToRelationInternal() const
     {
-        auto relation = TypeUtils::classPureBasename<Related>();
-
-        relation[0] = relation[0].toLower();
-
-        return relation;
+        return ModelMetadata<Related>::camelName();
     }
 
     /* Eager load relation store related */
@@ -1300,8 +1285,15 @@ namespace Concerns
     void HasRelationships<Derived, AllRelations...>::pushVisited() const
     {
         auto &pushStore = this->pushStore();
+        auto &models = std::get<ModelsCollection<Related>>(pushStore.models());
 
-        for (auto &model : std::get<ModelsCollection<Related>>(pushStore.models()))
+        /* Save all the related models by the batched inserts/updates in one
+           transaction, the push() below only recurses into their relations because
+           the saved models aren't dirty anymore. */
+        if (!models.saveAll())
+            return pushStore.setResult(false); // clazy:exclude=returning-void-expression
+
+        for (auto &model : models)
             if (!model.push())
                 return pushStore.setResult(false); // clazy:exclude=returning-void-expression
 
@@ -1329,13 +1321,13 @@ namespace Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     void
     HasRelationships<Derived, AllRelations...>::touchOwnersWithVisitor(
-            const QString &relation) const
+            const QString &relation, std::unordered_set<QString> *const touched) const
     {
         // Throw exception if a relation is not defined
         validateUserRelation(relation);
 
         // Save model/s to the store to avoid passing variables to the visitor
-        this->createTouchOwnersStore(relation).visit(relation);
+        this->createTouchOwnersStore(relation, touched).visit(relation);
 
         // Releases the ownership and destroy the top relation store on the stack
         this->resetRelationStore();
@@ -1344,8 +1336,15 @@ namespace Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     template<typename Related, typename Relation>
     void HasRelationships<Derived, AllRelations...>::touchOwnersVisited(
-            Relation &&relation, const QString &relationName)
+            Relation &&relation, const QString &relationName,
+            std::unordered_set<QString> *const touched)
     {
+        // The same owners were already touched, also their owners
+        if (touched != nullptr &&
+            !touched->insert(touchedOwnersKey(relation->getBaseQuery())).second
+        )
+            return;
+
         relation->touch();
 
         // Many type relation
@@ -1356,8 +1355,12 @@ namespace Concerns
                 /* I have checked it more times and the getRelation/Value() related
                    methods can't contain the nullptr in any case but I leave this check
                    here anyway. */
-                if (relatedModel)
-                    relatedModel->touchOwners();
+                if (relatedModel) {
+                    if (touched == nullptr)
+                        relatedModel->touchOwners();
+                    else
+                        relatedModel->touchOwners(*touched);
+                }
         }
 
         // One type relation
@@ -1366,13 +1369,31 @@ namespace Concerns
         {
             if (auto *const relatedModel = getRelationValue<Related, One>(relationName);
                 relatedModel
-            )
-                relatedModel->touchOwners();
+            ) {
+                if (touched == nullptr)
+                    relatedModel->touchOwners();
+                else
+                    relatedModel->touchOwners(*touched);
+            }
         } else
             throw Orm::Exceptions::InvalidTemplateArgumentError(
                     "Bad relation type passed to the Model::touchOwnersVisited().");
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QString
+    HasRelationships<Derived, AllRelations...>::touchedOwnersKey(QueryBuilder &query)
+    {
+        /* The relation query is constrained to the owners of the model, so the same
+           query with the same bindings touches the same owners. */
+        auto key = query.toSql();
+
+        for (const auto &binding : query.getBindings())
+            key += QChar(u'\x1F') + binding.toString();
+
+        return key;
+    }
+
     /* QueriesRelationships store related */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1457,6 +1478,36 @@ namespace Concerns
 
     /* Serialization - Relations */
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<SerializedAttributes C, typename PivotType>
+    void
+    HasRelationships<Derived, AllRelations...>::serializeRelationsTo(C &attributes) const
+    {
+        const auto serializableRelations = getSerializableRelations();
+
+        if constexpr (HasReserveMethod<C>)
+            attributes.reserve(static_cast<QVector<AttributeItem>::size_type>(
+                                   serializableRelations.size()));
+
+        for (const auto &[relation, models] : serializableRelations) {
+            Q_ASSERT(!models.valueless_by_exception());
+
+            // Serialize belongs-to-many relation or the pivot model
+            if constexpr (hasPivotRelation() && !std::is_void_v<PivotType>) {
+                // Pivot model, skipping the relation store, call the visited directly
+                if (m_pivots.contains(relation))
+                    serializeRelationVisited<PivotType, C, void>(relation, models,
+                                                                 attributes);
+                // belongs-to-many relation
+                else
+                    serializeRelationWithVisitor(relation, models, attributes);
+            }
+            // Serialize has-one, has-many, and belongs-to relations
+            else
+                serializeRelationWithVisitor(relation, models, attributes);
+        }
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     template<SerializedAttributes C>
     void HasRelationships<Derived, AllRelations...>::serializeRelationWithVisitor(
@@ -1477,39 +1528,46 @@ namespace Concerns
             QString relation, const RelationsType<AllRelations...> &models,
             C &attributes) const
     {
-        QVariant relationSerialized;
+        /* If the relationships snake-casing is enabled, we will snake_case this
+           key so that the relation attribute is snake_cased in this returned
+           map to the developers, making this consistent with attributes. */
+        if (basemodel().getUserSnakeAttributes())
+            relation = StringUtils::snake(std::move(relation));
 
-        /*! Determine whether the toMap() or toVector() was invoked. */
-        constexpr auto IsMap = std::is_same_v<C, QVariantMap>;
+        // Write the relation directly to the JSON writer, without the QVariant-s
+        if constexpr (std::is_same_v<C, Orm::Support::JsonWriter>)
+            writeSerializedRelation<Related, PivotType>(attributes, relation, models);
 
-        // Many type relationship
-        if (std::holds_alternative<ModelsCollection<Related>>(models))
-            serializeRelation<Related, IsMap, PivotType>(
-                        relationSerialized, std::get<ModelsCollection<Related>>(models));
+        else {
+            QVariant relationSerialized;
 
-        // One type relationship
-        else if (std::holds_alternative<std::optional<Related>>(models))
-            // No need to pass the PivotType down for the one type relation
-            serializeRelation<Related, IsMap>(
-                        relationSerialized, std::get<std::optional<Related>>(models));
+            /*! Determine whether the toMap() or toVector() was invoked. */
+            constexpr auto IsMap = std::is_same_v<C, QVariantMap>;
 
-        else
-            Q_UNREACHABLE();
+            // Many type relationship
+            if (std::holds_alternative<ModelsCollection<Related>>(models))
+                serializeRelation<Related, IsMap, PivotType>(
+                            relationSerialized,
+                            std::get<ModelsCollection<Related>>(models));
 
-        /* Practically useless because the "if" checks above check all possible
-           cases, but I leave it here anyway. */
-        Q_ASSERT(relationSerialized.isValid());
+            // One type relationship
+            else if (std::holds_alternative<std::optional<Related>>(models))
+                // No need to pass the PivotType down for the one type relation
+                serializeRelation<Related, IsMap>(
+                            relationSerialized, std::get<std::optional<Related>>(models));
 
-        /* If the relationships snake-casing is enabled, we will snake_case this
-           key so that the relation attribute is snake_cased in this returned
-           map to the developers, making this consistent with attributes. */
-        if (basemodel().getUserSnakeAttributes())
-            relation = StringUtils::snake(std::move(relation));
+            else
+                Q_UNREACHABLE();
+
+            /* Practically useless because the "if" checks above check all possible
+               cases, but I leave it here anyway. */
+            Q_ASSERT(relationSerialized.isValid());
 
-        /* Insert or emplace the serialized relation attributes to the final attributes
-           map or vector. */
-        insertSerializedRelation(attributes, std::move(relation),
-                                 std::move(relationSerialized));
+            /* Insert or emplace the serialized relation attributes to the final
+               attributes map or vector. */
+            insertSerializedRelation(attributes, std::move(relation),
+                                     std::move(relationSerialized));
+        }
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1563,6 +1621,33 @@ namespace Concerns
 #endif
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<typename Related, typename PivotType>
+    void HasRelationships<Derived, AllRelations...>::writeSerializedRelation(
+            Orm::Support::JsonWriter &writer, const QString &relation,
+            const RelationsType<AllRelations...> &models)
+    {
+        writer.writeKey(relation);
+
+        // Many type relationship
+        if (std::holds_alternative<ModelsCollection<Related>>(models))
+            std::get<ModelsCollection<Related>>(models)
+                    .template serializeToJson<PivotType>(writer);
+
+        // One type relationship
+        else if (std::holds_alternative<std::optional<Related>>(models)) {
+            // No need to pass the PivotType down for the one type relation
+            if (const auto &model = std::get<std::optional<Related>>(models); model)
+                model->serializeToJson(writer);
+            // A NULL foreign key
+            else
+                writer.writeNull();
+        }
+
+        else
+            Q_UNREACHABLE();
+    }
+
     /* Serialization - HidesAttributes */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -69,7 +69,9 @@ namespace Orm::Tiny::Concerns
         /*! Factory method to create the push store. */
         BaseRelationStore &createPushStore(RelationsType<AllRelations...> &models) const;
         /*! Factory method to create the touch owners store. */
-        BaseRelationStore &createTouchOwnersStore(const QString &relation) const;
+        BaseRelationStore &
+        createTouchOwnersStore(const QString &relation,
+                               std::unordered_set<QString> *touched) const;
         /*! Factory method to create the lazy store. */
         template<typename Related>
         BaseRelationStore &createLazyStore() const;
@@ -253,10 +255,11 @@ namespace Orm::Tiny::Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     typename HasRelationStore<Derived, AllRelations...>::BaseRelationStore &
     HasRelationStore<Derived, AllRelations...>::createTouchOwnersStore(
-            const QString &relation) const
+            const QString &relation, std::unordered_set<QString> *const touched) const
     {
         m_relationStore.push(std::make_shared<TouchOwnersRelationStore>(
-                                 const_cast<HasRelationStore *>(this), relation));
+                                 const_cast<HasRelationStore *>(this), relation,
+                                 touched));
 
         return *m_relationStore.top();
     }
@@ -593,8 +593,9 @@ namespace Private
 //            $from->removedScopes()
 //        )->mergeWheres(
 
-        return query().mergeWheres(from.getQuery().getWheres(),
-                                   from.getQuery().getRawBindings()[BindingType::WHERE]);
+        return query().mergeWheres(
+                    from.getQuery().getWheres(),
+                    from.getQuery().getRawBindings().value(BindingType::WHERE));
     }
 
     template<typename Model>
@@ -17,6 +17,7 @@ TINY_SYSTEM_HEADER
 #include "orm/tiny/exceptions/massassignmenterror.hpp"
 #include "orm/tiny/modelproxies.hpp"
 #include "orm/tiny/tinybuilder.hpp" // IWYU pragma: keep
+#include "orm/tiny/types/modelmetadata.hpp"
 #ifdef TINYORM_TESTS_CODE
 #  include "orm/tiny/types/connectionoverride.hpp"
 #endif
@@ -65,13 +66,14 @@ namespace Orm::Tiny
         // FUTURE try to solve problem with forward declarations for friend methods, to allow only relevant methods from TinyBuilder silverqx
         // Used by TinyBuilder::eagerLoadRelations()
         friend TinyBuilder<Derived>;
+        // To access syncChanges() and getKeyForSaveQuery()
+        template<DerivedCollectionModel CollectionModel>
+        friend class Types::ModelsCollection;
 
         /*! Alias for the attribute utils. */
         using AttributeUtils = Orm::Tiny::Utils::Attribute;
         /*! Alias for the helper utils. */
         using Helpers = Orm::Utils::Helpers;
-        /*! Alias for the string utils. */
-        using StringUtils = Orm::Utils::String;
         /*! Alias for the type utils. */
         using TypeUtils = Orm::Utils::Type;
         /*! Apply all the Model's template parameters to the passed T template
@@ -287,6 +289,12 @@ namespace Orm::Tiny
         Derived
         newFromBuilder(QVector<AttributeItem> &&attributes = {},
                        const std::optional<QString> &connection = std::nullopt) const;
+        /*! Create a new model instance that is existing, the attributes layout is
+            shared with other models hydrated from the same result set. */
+        Derived
+        newFromBuilder(QVector<AttributeItem> &&attributes,
+                       const AttributesLayout &layout,
+                       const std::optional<QString> &connection = std::nullopt) const;
         /*! Create a new instance of the given model. */
         inline Derived newInstance() const;
         /*! Create a new instance of the given model. */
@@ -326,6 +334,18 @@ namespace Orm::Tiny
         inline QByteArray
         toJson(QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
 
+        /*! Write the model instance as JSON to the given buffer (appends to it),
+            without the intermediate QVariantMap and QJsonObject. */
+        void writeJson(QByteArray &json,
+                       QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+        /*! Write the model instance as JSON to the given device, without
+            the intermediate QVariantMap and QJsonObject. */
+        bool writeJson(QIODevice &device,
+                       QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+        /*! Write the model instance to the given JSON writer. */
+        template<typename PivotType = void> // PivotType is primarily internal
+        void serializeToJson(Orm::Support::JsonWriter &writer) const;
+
         /* Getters / Setters */
         /*! Get the current connection name for the model. */
         const QString &getConnectionName() const;
@@ -462,9 +482,9 @@ namespace Orm::Tiny
         /*! Get the u_dates attribute from the Derived model. */
         inline static const QStringList &getUserDates() noexcept;
         /*! Get the casts hash. */
-        inline std::unordered_map<QString, CastItem> &getUserCasts() noexcept;
-        /*! Get the casts hash. */
         inline const std::unordered_map<QString, CastItem> &getUserCasts() const noexcept;
+        /*! Set the casts hash (use the HasAttributes::mergeCasts() or resetCasts()). */
+        inline void setUserCasts(std::unordered_map<QString, CastItem> &&casts);
         /*! Get the u_snakeAttributes attribute from the Derived model. */
         inline bool &getUserSnakeAttributes() noexcept;
         /*! Get the u_snakeAttributes attribute from the Derived model. */
@@ -487,8 +507,8 @@ namespace Orm::Tiny
                                  ::RelationVisitor;
 
         /*! Get the u_relations map from the Derived model. */
-        inline const QHash<QString, RelationVisitorAlias> &
-        getUserRelations() const noexcept;
+        inline static const QHash<QString, RelationVisitorAlias> &
+        getUserRelations() noexcept;
         /*! Get the u_touches relation names to touch from the Derived model. */
         inline const QStringList &getUserTouches() const noexcept;
         /*! Get the u_touches relation names to touch from the Derived model. */
@@ -1082,14 +1102,6 @@ namespace Orm::Tiny
         // Compare data members in the Derived Model 😮🤯😎
         const auto &derivedRight = static_cast<const Derived &>(right);
 
-        // model().u_relations == derivedRight.u_relations
-        /* It compares only the size and keys and doesn't compare hash values because
-           the std::function doesn't have a full/complete operator==() (it only compares
-           for the nullptr). */
-        if (!HasRelationships::compareURelations(model.u_relations,
-                                                 derivedRight.u_relations))
-            return false;
-
         /* Thanks to the CRTP the user doesn't have to define operator==() in every
            model, the u_xyz data members are compared here. I don't like it though,
            one caveat of this is that if a user defines the operator==() then these
@@ -1294,6 +1306,21 @@ namespace Orm::Tiny
         return model;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived
+    Model<Derived, AllRelations...>::newFromBuilder(
+            QVector<AttributeItem> &&attributes, const AttributesLayout &layout,
+            const std::optional<QString> &connection) const
+    {
+        auto model = newInstance({}, true);
+
+        model.setRawAttributes(std::move(attributes), layout, true);
+
+        model.setConnection(connection ? *connection : getConnectionName());
+
+        return model;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived
     Model<Derived, AllRelations...>::newInstance() const
@@ -1316,7 +1343,7 @@ namespace Orm::Tiny
            the connection have to be set before fill(). */
         model.setConnection(getConnectionName());
 
-        model.mergeCasts(std::as_const(*this).getUserCasts());
+        // The u_casts is static so the model already has the same casts
         model.fill(attributes);
 
         // I want to have these two as the last thing
@@ -1341,7 +1368,7 @@ namespace Orm::Tiny
            the connection have to be set before fill(). */
         model.setConnection(getConnectionName());
 
-        model.mergeCasts(std::as_const(*this).getUserCasts());
+        // The u_casts is static so the model already has the same casts
         model.fill(std::move(attributes));
 
         // I want to have these two as the last thing
@@ -1441,6 +1468,43 @@ namespace Orm::Tiny
         return toJsonDocument().toJson(format);
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void
+    Model<Derived, AllRelations...>::writeJson(
+            QByteArray &json, const QJsonDocument::JsonFormat format) const
+    {
+        Orm::Support::JsonWriter writer(json, format);
+
+        serializeToJson(writer);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool
+    Model<Derived, AllRelations...>::writeJson(
+            QIODevice &device, const QJsonDocument::JsonFormat format) const
+    {
+        Orm::Support::JsonWriter writer(device, format);
+
+        serializeToJson(writer);
+
+        return writer.flush();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    template<typename PivotType>
+    void
+    Model<Derived, AllRelations...>::serializeToJson(
+            Orm::Support::JsonWriter &writer) const
+    {
+        writer.beginObject();
+
+        this->attributesToJson(writer);
+
+        this->template serializeRelationsTo<Orm::Support::JsonWriter,
+                                            PivotType>(writer);
+        writer.endObject();
+    }
+
     /* Getters / Setters */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1506,11 +1570,10 @@ namespace Orm::Tiny
 
         const auto &table = model.u_table;
 
-        // Guess as pluralized snake_case table name and set the u_table
+        /* Guess as pluralized snake_case table name and set the u_table, it's shared
+           with the cached type's metadata so no allocation is needed. */
         if (table.isEmpty())
-            const_cast<QString &>(model.u_table) =
-                TMPL_PLURAL.arg(
-                    StringUtils::snake(TypeUtils::classPureBasename<Derived>()));
+            const_cast<QString &>(model.u_table) = ModelMetadata<Derived>::defaultTable();
 
         return table;
     }
@@ -1526,7 +1589,13 @@ namespace Orm::Tiny
     QString
     Model<Derived, AllRelations...>::getQualifiedKeyName() const
     {
-        return qualifyColumn(getKeyName());
+        const auto &keyName = getKeyName();
+
+        if (keyName.contains(DOT))
+            return keyName;
+
+        // model() needed as it's overriden in the BasePivot
+        return ModelMetadata<Derived>::qualifiedKeyName(model().getTable(), keyName);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1564,9 +1633,7 @@ namespace Orm::Tiny
     template<typename Derived, AllRelationsConcept ...AllRelations>
     QString Model<Derived, AllRelations...>::getForeignKey() const
     {
-        return QStringLiteral("%1_%2").arg(
-                    StringUtils::snake(TypeUtils::classPureBasename<Derived>()),
-                    getKeyName());
+        return ModelMetadata<Derived>::foreignKey(getKeyName());
     }
 
     /* Others */
@@ -1923,17 +1990,17 @@ namespace Orm::Tiny
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
-    std::unordered_map<QString, CastItem> &
-    Model<Derived, AllRelations...>::getUserCasts() noexcept
+    const std::unordered_map<QString, CastItem> &
+    Model<Derived, AllRelations...>::getUserCasts() const noexcept
     {
         return Derived::u_casts;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
-    const std::unordered_map<QString, CastItem> &
-    Model<Derived, AllRelations...>::getUserCasts() const noexcept
+    void Model<Derived, AllRelations...>::setUserCasts(
+            std::unordered_map<QString, CastItem> &&casts)
     {
-        return Derived::u_casts;
+        Derived::u_casts = std::move(casts);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1983,9 +2050,9 @@ namespace Orm::Tiny
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     const QHash<QString, typename Model<Derived, AllRelations...>::RelationVisitorAlias> &
-    Model<Derived, AllRelations...>::getUserRelations() const noexcept
+    Model<Derived, AllRelations...>::getUserRelations() noexcept
     {
-        return model().u_relations;
+        return Derived::u_relations;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
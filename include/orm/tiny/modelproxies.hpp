@@ -6,6 +6,7 @@
 TINY_SYSTEM_HEADER
 
 #include "orm/ormconcepts.hpp"
+#include "orm/query/cursor.hpp"
 #include "orm/tiny/types/modelscollection.hpp"
 #include "orm/types/sqlquery.hpp"
 
@@ -36,6 +37,9 @@ namespace Tiny
 
     public:
         /* Retrieving results */
+        /*! Get a lazy cursor over the models (one model is hydrated per iteration). */
+        static Query::Cursor<Derived> cursor(const QVector<Column> &columns = {ASTERISK});
+
         /*! Get a single column's value from the first result of a query. */
         static QVariant value(const Column &column);
         /*! Get a single column's value from the first result of a query if it's
@@ -202,11 +206,22 @@ namespace Tiny
         /*! Insert new records into the database (multi insert). */
         static std::optional<SqlQuery>
         insert(const QVector<QString> &columns, QVector<QVector<QVariant>> values);
+        /*! Insert new records into the database in batches sized to the grammar's
+            parameters limit, returns the number of inserted rows. */
+        static qint64
+        insertBatched(const QVector<QString> &columns, QVector<QVector<QVariant>> values,
+                      bool transaction = false);
 
         /*! Insert a new record and get the value of the primary key. */
         static quint64
         insertGetId(const QVector<AttributeItem> &values,
                     const QString &sequence = "");
+        /*! Insert new records in batches and get the values of their primary keys
+            in the order returned by the returning clause. */
+        static QVector<QVariant>
+        insertGetIds(const QVector<QString> &columns,
+                     const QVector<QVector<QVariant>> &values,
+                     const QString &sequence = "");
 
         /*! Insert a new record into the database while ignoring errors. */
         static std::tuple<int, std::optional<QSqlQuery>>
@@ -865,6 +880,17 @@ namespace Tiny
         static std::unique_ptr<TinyBuilder<Derived>>
         lock(QString &&value);
 
+        /* Forward-only mode */
+        /*! Execute the select query in the forward-only mode (the result is streamed
+            and can be traversed only once), overrides the connection's mode. */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        forwardOnly(bool value = true);
+
+        /* Read/write connections */
+        /*! Use the write connection for the select query (instead of a read replica). */
+        static std::unique_ptr<TinyBuilder<Derived>>
+        useWriteConnection(bool value = true);
+
         /* Builds Queries */
         /*! Chunk the results of the query. */
         static bool
@@ -1042,6 +1068,13 @@ namespace Tiny
 
     /* Retrieving results */
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Query::Cursor<Derived>
+    ModelProxies<Derived, AllRelations...>::cursor(const QVector<Column> &columns)
+    {
+        return query()->cursor(columns);
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     QVariant ModelProxies<Derived, AllRelations...>::value(const Column &column)
     {
@@ -1432,6 +1465,15 @@ namespace Tiny
         return query()->insert(columns, std::move(values));
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    qint64
+    ModelProxies<Derived, AllRelations...>::insertBatched(
+            const QVector<QString> &columns, QVector<QVector<QVariant>> values,
+            const bool transaction)
+    {
+        return query()->insertBatched(columns, std::move(values), transaction);
+    }
+
     // FEATURE dilemma primarykey, Derived::KeyType vs QVariant silverqx
     template<typename Derived, AllRelationsConcept ...AllRelations>
     quint64
@@ -1441,6 +1483,15 @@ namespace Tiny
         return query()->insertGetId(values, sequence);
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QVector<QVariant>
+    ModelProxies<Derived, AllRelations...>::insertGetIds(
+            const QVector<QString> &columns, const QVector<QVector<QVariant>> &values,
+            const QString &sequence)
+    {
+        return query()->insertGetIds(columns, values, sequence);
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     std::tuple<int, std::optional<QSqlQuery>>
     ModelProxies<Derived, AllRelations...>::insertOrIgnore(
@@ -3359,6 +3410,32 @@ namespace Tiny
         return builder;
     }
 
+    /* Forward-only mode */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::forwardOnly(const bool value)
+    {
+        auto builder = query();
+
+        builder->forwardOnly(value);
+
+        return builder;
+    }
+
+    /* Read/write connections */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::unique_ptr<TinyBuilder<Derived>>
+    ModelProxies<Derived, AllRelations...>::useWriteConnection(const bool value)
+    {
+        auto builder = query();
+
+        builder->useWriteConnection(value);
+
+        return builder;
+    }
+
     /* Builds Queries */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
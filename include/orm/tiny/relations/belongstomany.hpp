@@ -9,6 +9,7 @@ TINY_SYSTEM_HEADER
 #include "orm/tiny/exceptions/modelnotfounderror.hpp"
 #include "orm/tiny/relations/concerns/interactswithpivottable.hpp"
 #include "orm/tiny/relations/relation.hpp"
+#include "orm/tiny/types/modelmetadata.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -1328,8 +1329,8 @@ namespace Orm::Tiny::Relations
         auto query = this->newPivotQuery()->get({m_relatedPivotKey});
 
         QVector<QVariant> ids;
-        ids.reserve(static_cast<decltype (ids)::size_type>(
-                        QueryUtils::queryResultSize(query)));
+        if (const auto size = QueryUtils::queryResultSizeHint(query); size)
+            ids.reserve(static_cast<decltype (ids)::size_type>(*size));
 
         while (query.next())
             ids << query.value(m_relatedPivotKey);
@@ -1514,11 +1515,7 @@ namespace Orm::Tiny::Relations
     QString BelongsToMany<Model, Related, PivotType>::guessInverseRelation() const
     {
         // FEATURE relations, add parent touches (eg parentTouchesName) to the Model::belongsToMany factory method silverqx
-        auto relation = TypeUtils::classPureBasename<Model>();
-
-        relation[0] = relation[0].toLower();
-
-        return TMPL_PLURAL.arg(relation);
+        return TMPL_PLURAL.arg(ModelMetadata<Model>::camelName());
     }
 
     /* Others */
@@ -824,8 +824,8 @@ namespace Concerns
         auto query = newPivotQuery()->get();
 
         QVector<PivotType> pivots;
-        pivots.reserve(static_cast<decltype (pivots)::size_type>(
-                           QueryUtils::queryResultSize(query)));
+        if (const auto size = QueryUtils::queryResultSizeHint(query); size)
+            pivots.reserve(static_cast<decltype (pivots)::size_type>(*size));
 
         while (query.next())
             // std::move() is really needed here
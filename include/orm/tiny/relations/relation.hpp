@@ -105,6 +105,13 @@ namespace Relations
 
         /*! Get the relationship for eager loading. */
         inline ModelsCollection<Related> getEager() const;
+        /*! Get the relationship for eager loading, the parent models are split
+            to chunks and every chunk is loaded using its own query (adds the eager
+            constraints and the user constraints for every chunk). */
+        template<SameDerivedCollectionModel<Model> CollectionModel>
+        ModelsCollection<Related>
+        getEagerChunked(ModelsCollection<CollectionModel> &models, qsizetype chunkSize,
+                        const std::function<void(QueryBuilder &)> &constraints = nullptr);
         /*! Execute the query as a "select" statement. */
         inline virtual ModelsCollection<Related>
         get(const QVector<Column> &columns = {ASTERISK}) const;
@@ -249,6 +256,62 @@ namespace Relations
         return get();
     }
 
+    template<class Model, class Related>
+    template<SameDerivedCollectionModel<Model> CollectionModel>
+    ModelsCollection<Related>
+    Relation<Model, Related>::getEagerChunked(
+            ModelsCollection<CollectionModel> &models, const qsizetype chunkSize,
+            const std::function<void(QueryBuilder &)> &constraints)
+    {
+        Q_ASSERT(chunkSize > 0);
+
+        /* The query without the eager constraints, every chunk is queried using
+           its copy, the underlying QueryBuilder must be copied too because the eager
+           constraints are added to it. */
+        const auto query = m_query;
+
+        using SizeType = typename ModelsCollection<CollectionModel>::size_type;
+        const auto size = static_cast<SizeType>(chunkSize);
+
+        ModelsCollection<Related> results;
+
+        try {
+            for (SizeType offset = 0; offset < models.size(); offset += size) {
+                const auto chunkEnd = std::min(offset + size, models.size());
+
+                ModelsCollection<Model *> chunk;
+                chunk.reserve(chunkEnd - offset);
+
+                for (auto i = offset; i < chunkEnd; ++i)
+                    chunk << toPointer(models[i]);
+
+                m_query = std::make_shared<Builder<Related>>(*query);
+                m_query->setQuery(std::make_shared<QueryBuilder>(query->getQuery()));
+                m_eagerKeysWereEmpty = false;
+
+                addEagerConstraints(chunk);
+
+                if (constraints)
+                    std::invoke(constraints, getBaseQuery());
+
+                auto chunkResults = getEager();
+
+                results.reserve(results.size() + chunkResults.size());
+
+                for (auto &&model : chunkResults)
+                    results << std::move(model);
+            }
+        } catch (...) {
+            m_query = query;
+
+            throw;
+        }
+
+        m_query = query;
+
+        return results;
+    }
+
     template<class Model, class Related>
     ModelsCollection<Related>
     Relation<Model, Related>::get(const QVector<Column> &columns) const
@@ -207,6 +207,11 @@ namespace Tiny::Relations
         /*! Insert new records into the database (multi insert). */
         std::optional<SqlQuery>
         insert(const QVector<QString> &columns, QVector<QVector<QVariant>> values) const;
+        /*! Insert new records into the database in batches sized to the grammar's
+            parameters limit, returns the number of inserted rows. */
+        qint64 insertBatched(const QVector<QString> &columns,
+                             QVector<QVector<QVariant>> values,
+                             bool transaction = false) const;
 
         /*! Insert a new record and get the value of the primary key. */
         quint64 insertGetId(const QVector<AttributeItem> &attributes,
@@ -850,6 +855,15 @@ namespace Tiny::Relations
         /*! Lock the selected rows in the table. */
         const Relation<Model, Related> &lock(QString &&value) const;
 
+        /* Forward-only mode */
+        /*! Execute the select query in the forward-only mode (the result is streamed
+            and can be traversed only once), overrides the connection's mode. */
+        const Relation<Model, Related> &forwardOnly(bool value = true) const;
+
+        /* Read/write connections */
+        /*! Use the write connection for the select query (instead of a read replica). */
+        const Relation<Model, Related> &useWriteConnection(bool value = true) const;
+
         /* Debugging */
         /*! Dump the current SQL and bindings. */
         void dump(bool replaceBindings = true, bool simpleBindings = false) const;
@@ -1421,6 +1435,15 @@ namespace Tiny::Relations
         return getQuery().insert(columns, std::move(values));
     }
 
+    template<class Model, class Related>
+    qint64
+    RelationProxies<Model, Related>::insertBatched(
+            const QVector<QString> &columns, QVector<QVector<QVariant>> values,
+            const bool transaction) const
+    {
+        return getQuery().insertBatched(columns, std::move(values), transaction);
+    }
+
     // FEATURE dilemma primarykey, Model::KeyType vs QVariant silverqx
     template<class Model, class Related>
     quint64
@@ -3102,6 +3125,28 @@ namespace Tiny::Relations
         return relation();
     }
 
+    /* Forward-only mode */
+
+    template<class Model, class Related>
+    const Relation<Model, Related> &
+    RelationProxies<Model, Related>::forwardOnly(const bool value) const
+    {
+        getQuery().forwardOnly(value);
+
+        return relation();
+    }
+
+    /* Read/write connections */
+
+    template<class Model, class Related>
+    const Relation<Model, Related> &
+    RelationProxies<Model, Related>::useWriteConnection(const bool value) const
+    {
+        getQuery().useWriteConnection(value);
+
+        return relation();
+    }
+
     /* Debugging */
 
     template<class Model, class Related>
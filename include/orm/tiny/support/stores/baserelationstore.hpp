@@ -77,6 +77,7 @@ namespace Support::Stores
         QUERIES_RELATIONSHIPS_TINY_NESTED,
         RELATION_TO_MAP,
         RELATION_TO_VECTOR,
+        RELATION_TO_JSON,
     };
 
     /*! Base class for relation stores. */
@@ -115,7 +116,7 @@ namespace Support::Stores
     protected:
         /*! Called from Model::u_relations to pass reference to the relation method,
             an enter point of the visitation. */
-        template<RelationshipMethod<Derived> Method>
+        template<typename Method>
         void operator()(Method method);
 
         /*! Currently held store type. */
@@ -156,9 +157,14 @@ namespace Support::Stores
     /* public */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
-    template<RelationshipMethod<Derived> Method>
+    template<typename Method>
     void BaseRelationStore<Derived, AllRelations...>::operator()(const Method method)
     {
+        /* Can't be checked in the template parameter list, the static u_relations
+           initializer is instantiated while the Derived model is still incomplete. */
+        static_assert (RelationshipMethod<Method, Derived>,
+                "The Method template parameter must be the relationship method.");
+
         const auto storeType = getStoreType();
 
         switch (storeType) {
@@ -188,6 +194,7 @@ namespace Support::Stores
         case RelationStoreType::QUERIES_RELATIONSHIPS_TINY_NESTED:
         case RelationStoreType::RELATION_TO_MAP:
         case RelationStoreType::RELATION_TO_VECTOR:
+        case RelationStoreType::RELATION_TO_JSON:
         {
             using Related = typename std::invoke_result_t<Method, Derived>
                                         ::element_type::RelatedType;
@@ -217,6 +224,11 @@ namespace Support::Stores
                         ->visited(method);
                 break;
 
+            case RelationStoreType::RELATION_TO_JSON:
+                static_cast<SerializeRelationStore<Orm::Support::JsonWriter> *>(this)
+                        ->visited(method);
+                break;
+
             default:
                 Q_UNREACHABLE();
             }
@@ -272,7 +284,9 @@ namespace Support::Stores
     template<typename Derived, AllRelationsConcept ...AllRelations>
     void BaseRelationStore<Derived, AllRelations...>::visit(const QString &relation)
     {
-        std::invoke(basemodel().getUserRelations().find(relation).value(), *this);
+        std::invoke(Model<Derived, AllRelations...>::getUserRelations()
+                            .find(relation).value(),
+                    *this);
     }
 
 } // namespace Support::Stores
@@ -55,14 +55,15 @@ namespace Support::Stores
         /*! Store type initializer. */
         constexpr static RelationStoreType initStoreType();
 
-        /*! Currently served store type, this class can handle two store types. */
+        /*! Currently served store type, this class can handle three store types. */
         constexpr static const RelationStoreType STORE_TYPE = initStoreType(); // thread_local not needed
 
         /*! The name of the relationship to serialize. */
         NotNull<const QString *> m_relation;
         /*! Models to serialize, the reference to the relation in the m_relations hash. */
         NotNull<const RelationsType<AllRelations...> *> m_models;
-        /*! The reference to the container that will store serialized attributes. */
+        /*! The reference to the container that will store serialized attributes
+            (or to the JSON writer). */
         NotNull<C *> m_attributes;
     };
 
@@ -93,8 +94,8 @@ namespace Support::Stores
 
         /* Here is the last and only one chance where we can obtain the PivotType
            for the belongs-to-many relation, so we need to pass it down, so that
-           the toMap() or toVector() can obtain the correct pivot model type
-           from the m_relations map's std::variant. */
+           the toMap(), toVector(), or writeJson() can obtain the correct pivot model
+           type from the m_relations map's std::variant. */
 
         // belongs-to-many
         if constexpr (std::is_base_of_v<Relations::IsPivotRelation, Relation>)
@@ -121,6 +122,9 @@ namespace Support::Stores
         else if constexpr (std::is_same_v<C, QVector<AttributeItem>>)
             return RelationStoreType::RELATION_TO_VECTOR;
 
+        else if constexpr (std::is_same_v<C, Orm::Support::JsonWriter>)
+            return RelationStoreType::RELATION_TO_JSON;
+
         else
             Q_UNREACHABLE();
     }
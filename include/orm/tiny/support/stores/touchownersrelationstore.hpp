@@ -5,6 +5,8 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <unordered_set>
+
 #include "orm/tiny/support/stores/baserelationstore.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -34,7 +36,8 @@ namespace Orm::Tiny::Support::Stores
     public:
         /*! Constructor. */
         TouchOwnersRelationStore(NotNull<HasRelationStore *> hasRelationStore,
-                                 const QString &relation);
+                                 const QString &relation,
+                                 std::unordered_set<QString> *touched);
         /*! Default destructor. */
         inline ~TouchOwnersRelationStore() = default;
 
@@ -46,16 +49,20 @@ namespace Orm::Tiny::Support::Stores
         /*! Models to touch timestamps for, the reference to the relation name/key
             in the m_relations hash. */
         NotNull<const QString *> m_relation;
+        /*! Already touched owners (nullptr to touch all owners). */
+        std::unordered_set<QString> *m_touched;
     };
 
     /* public */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     TouchOwnersRelationStore<Derived, AllRelations...>::TouchOwnersRelationStore(
-            NotNull<HasRelationStore *> hasRelationStore, const QString &relation
+            NotNull<HasRelationStore *> hasRelationStore, const QString &relation,
+            std::unordered_set<QString> *const touched
     )
         : BaseRelationStore_(hasRelationStore, RelationStoreType::TOUCH_OWNERS)
         , m_relation(&relation)
+        , m_touched(touched)
     {}
 
     /* private */
@@ -72,7 +79,7 @@ namespace Orm::Tiny::Support::Stores
 
         this->basemodel()
                 .template touchOwnersVisited<Related>(std::move(relationInstance),
-                                                      *m_relation);
+                                                      *m_relation, m_touched);
     }
 
 } // namespace Orm::Tiny::Support::Stores
@@ -7,6 +7,8 @@ TINY_SYSTEM_HEADER
 
 #include <QtSql/QSqlRecord>
 
+#include <unordered_set>
+
 #include <range/v3/action/transform.hpp>
 
 #include "orm/databaseconnection.hpp"
@@ -67,6 +69,9 @@ namespace Orm::Tiny
         /* Retrieving results */
         /*! Execute the query as a "select" statement. */
         ModelsCollection<Model> get(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a forward-only "select" statement and get a lazy
+            cursor over the models (one model is hydrated per iteration). */
+        Query::Cursor<Model> cursor(const QVector<Column> &columns = {ASTERISK});
 
         /*! Get a single column's value from the first result of a query. */
         QVariant value(const Column &column);
@@ -189,6 +194,10 @@ namespace Orm::Tiny
             any previously added eager loading specifications. */
         inline Builder &withOnly(QVector<QString> &&relations);
 
+        /*! Set the maximum number of parent models loaded by one eager loading query,
+            bigger sets of parent models are loaded in chunks (0 disables chunking). */
+        inline Builder &eagerChunkSize(qsizetype size) noexcept;
+
         /* Insert, Update, Delete */
         /*! Save a new model and return the instance. */
         Model create(const QVector<AttributeItem> &attributes = {});
@@ -233,7 +242,7 @@ namespace Orm::Tiny
         inline Builder &withCast(std::pair<QString, CastItem> cast);
 
         /* TinyBuilder methods */
-        /*! Clone the Tiny query. */
+        /*! Clone the Tiny query (the query builder is cloned too). */
         inline Builder clone() const;
         /*! Create a new instance of the model being queried. */
         Model newModelInstance(const QVector<AttributeItem> &attributes) const;
@@ -255,8 +264,30 @@ namespace Orm::Tiny
                 Relation &&relation, ModelsCollection<CollectionModel> &models,
                 const WithItem &relationItem) const;
 
-        /*! Create a vector of models from the SqlQuery. */
-        ModelsCollection<Model> hydrate(SqlQuery &&result) const;
+        /*! Create a vector of models from the SqlQuery (reads the result only once,
+            the sizeHint is used to reserve the models collection). */
+        ModelsCollection<Model>
+        hydrate(SqlQuery &&result, std::optional<int> sizeHint = std::nullopt) const;
+        /*! Attribute keys, value conversions, and the attributes layout resolved
+            once per result set. */
+        struct HydrationLayout
+        {
+            /*! Column indexes in the result set (without duplicate keys). */
+            QVector<int> columns;
+            /*! Attribute keys for the columns above (implicitly shared by models). */
+            QVector<QString> keys;
+            /*! Value conversions for the columns above (time zone, SQLite dates). */
+            QVector<SqlQuery::ValueConversion> conversions;
+            /*! Attributes layout shared by all hydrated models. */
+            AttributesLayout attributesLayout;
+        };
+
+        /*! Resolve the attribute keys, value conversions, and the attributes layout
+            of the result set. */
+        static HydrationLayout hydrationLayout(const SqlQuery &result);
+        /*! Create a new model instance from the current row of the SqlQuery. */
+        static Model hydrateRow(const Model &instance, const SqlQuery &result,
+                                const HydrationLayout &layout);
 
         /*! Get the model instance being queried. */
         inline Model &getModel() noexcept;
@@ -264,6 +295,8 @@ namespace Orm::Tiny
         inline QueryBuilder &getQuery() const noexcept;
         /*! Get the underlying query builder instance as a std::shared_ptr. */
         inline const std::shared_ptr<QueryBuilder> &getQueryShared() const noexcept;
+        /*! Set the underlying query builder instance. */
+        inline Builder &setQuery(std::shared_ptr<QueryBuilder> query) noexcept;
 
         /*! Get a database connection. */
         inline DatabaseConnection &getConnection();
@@ -304,6 +337,9 @@ namespace Orm::Tiny
         static QVector<WithItem>::size_type
         guessParseWithRelationsSize(const QVector<WithItem> &relations);
 
+        /*! Get the number of parent models loaded by one eager loading query. */
+        qsizetype getEagerChunkSize() const;
+
         /*! Get the deeply nested relations for a given top-level relation. */
         QVector<WithItem>
         relationsNestedUnder(const QString &topRelationName) const;
@@ -315,9 +351,13 @@ namespace Orm::Tiny
         QVector<UpdateItem>
         addUpdatedAtColumn(QVector<UpdateItem> values) const;
 
+        /*! Prepare the upserted values the same way as the model attributes are
+            prepared (dates) and add timestamps. */
+        QVector<QVariantMap>
+        prepareUpsertValues(QVector<QVariantMap> values) const;
         /*! Add timestamps to the inserted values. */
         QVector<QVariantMap>
-        addTimestampsToUpsertValues(const QVector<QVariantMap> &values) const;
+        addTimestampsToUpsertValues(QVector<QVariantMap> values) const;
         /*! Add the "updated at" column to the updated columns. */
         QStringList addUpdatedAtToUpsertColumns(const QStringList &update) const;
 
@@ -341,6 +381,9 @@ namespace Orm::Tiny
         Model m_model;
         /*! The relationships that should be eager loaded. */
         QVector<WithItem> m_eagerLoad;
+        /*! The maximum number of parent models loaded by one eager loading query
+            (guessed from the grammar's parameters limit if not set). */
+        std::optional<qsizetype> m_eagerChunkSize = std::nullopt;
 
         /*! A replacement for the typical delete function. */
         std::function<std::tuple<int, QSqlQuery>(Builder<Model> &)> m_onDelete = nullptr;
@@ -348,6 +391,10 @@ namespace Orm::Tiny
         /* BuildsSoftDeletes */
         /*! Determine whether the Model the TinyBuilder manages extends SoftDeletes. */
         constexpr static bool m_extendsSoftDeletes = Model::extendsSoftDeletes();
+
+        /*! Number of bindings left for the relation and user constraints when
+            the eager chunk size is guessed from the grammar's parameters limit. */
+        constexpr static qsizetype EagerChunkBindingsReserve = 100;
     };
 
     /* public */
@@ -400,6 +447,25 @@ namespace Orm::Tiny
 //        return getModel().newCollection(models);
     }
 
+    template<typename Model>
+    Query::Cursor<Model> Builder<Model>::cursor(const QVector<Column> &columns)
+    {
+        applySoftDeletes();
+
+        auto query = m_query->getForwardOnly(columns);
+        auto layout = hydrationLayout(query);
+
+        /* Relationships are not eager loaded as only one model is held in the memory,
+           use the chunk() or each() if you need to eager load relationships. */
+        return Query::Cursor<Model>(std::move(query),
+                                    [instance = newModelInstance(),
+                                     layout = std::move(layout)]
+                                    (const SqlQuery &result)
+        {
+            return hydrateRow(instance, result, layout);
+        });
+    }
+
     template<typename Model>
     QVariant Builder<Model>::value(const Column &column)
     {
@@ -857,6 +923,14 @@ namespace Orm::Tiny
         return withOnly(WithItem::fromStringVector(std::move(relations)));
     }
 
+    template<typename Model>
+    Builder<Model> &Builder<Model>::eagerChunkSize(const qsizetype size) noexcept
+    {
+        m_eagerChunkSize = size;
+
+        return *this;
+    }
+
     /* Insert, Update, Delete */
 
     template<typename Model>
@@ -949,7 +1023,7 @@ namespace Orm::Tiny
                     "The upsert method doesn't support an empty update argument, please "
                     "use the insert method instead.");
 
-        return toBase().upsert(addTimestampsToUpsertValues(values), uniqueBy,
+        return toBase().upsert(prepareUpsertValues(values), uniqueBy,
                                addUpdatedAtToUpsertColumns(update));
     }
 
@@ -958,6 +1032,10 @@ namespace Orm::Tiny
     Builder<Model>::upsert(
             const QVector<QVariantMap> &values, const QStringList &uniqueBy)
     {
+        // Nothing to do, no values to insert or update
+        if (values.isEmpty())
+            return {0, std::nullopt};
+
         // Update all columns
         // Columns are obtained only from a first QMap
         const auto update = values.constFirst().keys();
@@ -1008,7 +1086,14 @@ namespace Orm::Tiny
     template<typename Model>
     Builder<Model> Builder<Model>::clone() const
     {
-        return *this;
+        auto copy = *this;
+
+        /* The clone can't share the query builder with this instance, otherwise
+           changing the clone would change this query too. The copy is cheap, query
+           parts are implicitly shared until they are changed. */
+        copy.m_query = std::make_shared<QueryBuilder>(*m_query);
+
+        return copy;
     }
 
     template<typename Model>
@@ -1128,6 +1213,24 @@ namespace Orm::Tiny
         if (nested.size() > 0)
             relation->getQuery().with(std::move(nested));
 
+        // Nested relations are chunked the same way
+        if (m_eagerChunkSize)
+            relation->getQuery().eagerChunkSize(*m_eagerChunkSize);
+
+        /* Too many parent models would produce the huge whereIn clause that can
+           exceed the database's parameters limit, so the parent models are split
+           to chunks, every chunk is loaded by its own query and the results are
+           matched at once. */
+        if (const auto chunkSize = getEagerChunkSize();
+            chunkSize > 0 && models.size() > chunkSize
+        ) {
+            relation->match(relation->initRelation(models, relationItem.name),
+                            relation->getEagerChunked(models, chunkSize,
+                                                      relationItem.constraints),
+                            relationItem.name);
+            return;
+        }
+
         relation->addEagerConstraints(models);
 
         // Add relation constraints defined in the user callback
@@ -1144,32 +1247,92 @@ namespace Orm::Tiny
 
     template<typename Model>
     ModelsCollection<Model>
-    Builder<Model>::hydrate(SqlQuery &&result) const
+    Builder<Model>::hydrate(SqlQuery &&result, std::optional<int> sizeHint) const
     {
         auto instance = newModelInstance();
 
-        ModelsCollection<Model> models;
-        models.reserve(static_cast<decltype (models)::size_type>(
-                           QueryUtils::queryResultSize(result)));
+        /* Don't use the QueryUtils::queryResultSize() here, it walks the whole result
+           set on drivers without the QuerySize feature (SQLite) and it also breaks
+           the forward-only queries, the models collection grows incrementally if
+           the size isn't known. */
+        if (!sizeHint)
+            sizeHint = QueryUtils::queryResultSizeHint(result, m_query->getLimit());
 
-        const auto fieldsCount = result.record().count();
+        ModelsCollection<Model> models;
+        if (sizeHint)
+            models.reserve(static_cast<decltype (models)::size_type>(*sizeHint));
 
-        while (result.next()) {
-            QVector<AttributeItem> row;
-            row.reserve(fieldsCount);
+        // All models hydrated from this result set share the same attributes layout
+        const auto layout = hydrationLayout(result);
 
-            // Populate model attributes with data from the database (one table row)
-            const auto record = result.record();
-            for (int i = 0; i < record.count(); ++i)
-                row.append({record.fieldName(i), result.value(i)});
+        while (result.next())
+            models << hydrateRow(instance, result, layout);
 
-            // Create a new model instance from the table row
-            models << instance.newFromBuilder(std::move(row));
-        }
+        // Release the result so the cached prepared statement can be re-used
+        result.finish();
 
         return models;
     }
 
+    template<typename Model>
+    typename Builder<Model>::HydrationLayout
+    Builder<Model>::hydrationLayout(const SqlQuery &result)
+    {
+        const auto record = result.record();
+        const auto fieldsCount = record.count();
+        const auto conversions = result.valueConversions(record);
+
+        HydrationLayout hydration;
+        hydration.columns.reserve(fieldsCount);
+        hydration.keys.reserve(fieldsCount);
+        hydration.conversions.reserve(fieldsCount);
+
+        /* Only the last column of the duplicate column names is used, the same as
+           the AttributeUtils::removeDuplicateKeys() does, so it's looped in
+           the reverse order. */
+        std::unordered_set<QString> added(static_cast<std::size_t>(fieldsCount));
+
+        for (auto i = fieldsCount - 1; i >= 0; --i)
+            if (auto fieldName = record.fieldName(i);
+                !added.contains(fieldName)
+            ) {
+                added.emplace(fieldName);
+                hydration.columns.prepend(i);
+                hydration.keys.prepend(std::move(fieldName));
+                hydration.conversions.prepend(conversions.at(i));
+            }
+
+        QVector<AttributeItem> attributes;
+        attributes.reserve(hydration.keys.size());
+
+        for (const auto &key : std::as_const(hydration.keys))
+            attributes.append({key, {}});
+
+        hydration.attributesLayout = AttributesLayout(attributes);
+
+        return hydration;
+    }
+
+    template<typename Model>
+    Model Builder<Model>::hydrateRow(const Model &instance, const SqlQuery &result,
+                                     const HydrationLayout &layout)
+    {
+        const auto columnsCount = layout.columns.size();
+
+        QVector<AttributeItem> row;
+        row.reserve(columnsCount);
+
+        /* Populate model attributes with data from the database (one table row),
+           keys are implicitly shared so they are not allocated for every row and
+           values are converted using the conversions resolved for the result set. */
+        for (decltype (row)::size_type i = 0; i < columnsCount; ++i)
+            row.append({layout.keys.at(i),
+                        result.value(layout.columns.at(i), layout.conversions.at(i))});
+
+        // Create a new model instance from the table row
+        return instance.newFromBuilder(std::move(row), layout.attributesLayout);
+    }
+
     template<typename Model>
     Model &Builder<Model>::getModel() noexcept
     {
@@ -1189,6 +1352,15 @@ namespace Orm::Tiny
         return m_query;
     }
 
+    template<typename Model>
+    Builder<Model> &
+    Builder<Model>::setQuery(std::shared_ptr<QueryBuilder> query) noexcept
+    {
+        m_query = std::move(query);
+
+        return *this;
+    }
+
     template<typename Model>
     DatabaseConnection &
     Builder<Model>::getConnection()
@@ -1409,6 +1581,17 @@ namespace Orm::Tiny
         return size;
     }
 
+    template<typename Model>
+    qsizetype Builder<Model>::getEagerChunkSize() const
+    {
+        if (m_eagerChunkSize)
+            return *m_eagerChunkSize;
+
+        return std::max<qsizetype>(
+                    1, m_query->getGrammar().getMaxParameters() -
+                       EagerChunkBindingsReserve);
+    }
+
     template<typename Model>
     QVector<WithItem>
     Builder<Model>::relationsNestedUnder(const QString &topRelationName) const
@@ -1486,7 +1669,20 @@ namespace Orm::Tiny
 
     template<typename Model>
     QVector<QVariantMap>
-    Builder<Model>::addTimestampsToUpsertValues(const QVector<QVariantMap> &values) const
+    Builder<Model>::prepareUpsertValues(QVector<QVariantMap> values) const
+    {
+        // The same as the Model::setAttribute() prepares the attribute values
+        for (auto &row : values)
+            for (auto itValue = row.begin(); itValue != row.end(); ++itValue)
+                itValue.value() = m_model.prepareAttributeForStorage(
+                                      itValue.key(), std::move(itValue.value()));
+
+        return addTimestampsToUpsertValues(std::move(values));
+    }
+
+    template<typename Model>
+    QVector<QVariantMap>
+    Builder<Model>::addTimestampsToUpsertValues(QVector<QVariantMap> values) const
     {
         // Nothing to do (model doesn't use timestamps)
         if (!m_model.usesTimestamps())
@@ -1511,15 +1707,14 @@ namespace Orm::Tiny
             return values;
 
         const auto timestamp = m_model.freshTimestampString();
-        auto valuesCopy = values;
 
         // Insert timestamp columns if a row doesn't already contain one
         for (const auto &column : columns)
-            for (auto &row : valuesCopy)
+            for (auto &row : values)
                 if (!row.contains(column))
                     row.insert(column, timestamp);
 
-        return valuesCopy;
+        return values;
     }
 
     template<typename Model>
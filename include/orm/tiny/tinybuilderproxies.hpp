@@ -123,10 +123,20 @@ namespace Tiny
         /*! Insert new records into the database (multi insert). */
         std::optional<SqlQuery>
         insert(const QVector<QString> &columns, QVector<QVector<QVariant>> values) const;
+        /*! Insert new records into the database in batches sized to the grammar's
+            parameters limit, returns the number of inserted rows. */
+        qint64 insertBatched(const QVector<QString> &columns,
+                             QVector<QVector<QVariant>> values,
+                             bool transaction = false) const;
 
         /*! Insert a new record and get the value of the primary key. */
         quint64 insertGetId(const QVector<AttributeItem> &values,
                             const QString &sequence = "") const;
+        /*! Insert new records in batches and get the values of their primary keys
+            in the order returned by the returning clause. */
+        QVector<QVariant> insertGetIds(const QVector<QString> &columns,
+                                       const QVector<QVector<QVariant>> &values,
+                                       const QString &sequence = "") const;
 
         /*! Insert a new record into the database while ignoring errors. */
         std::tuple<int, std::optional<QSqlQuery>>
@@ -671,6 +681,15 @@ namespace Tiny
         /*! Lock the selected rows in the table. */
         TinyBuilder<Model> &lock(QString &&value);
 
+        /* Forward-only mode */
+        /*! Execute the select query in the forward-only mode (the result is streamed
+            and can be traversed only once), overrides the connection's mode. */
+        TinyBuilder<Model> &forwardOnly(bool value = true);
+
+        /* Read/write connections */
+        /*! Use the write connection for the select query (instead of a read replica). */
+        TinyBuilder<Model> &useWriteConnection(bool value = true);
+
         /* Others proxy methods, not added to the Model and Relation */
         /*! Add an "exists" clause to the query. */
         TinyBuilder<Model> &
@@ -871,6 +890,15 @@ namespace Tiny
         return getQuery().insert(columns, std::move(values));
     }
 
+    template<typename Model>
+    qint64
+    BuilderProxies<Model>::insertBatched(
+            const QVector<QString> &columns, QVector<QVector<QVariant>> values,
+            const bool transaction) const
+    {
+        return getQuery().insertBatched(columns, std::move(values), transaction);
+    }
+
     // FEATURE dilemma primarykey, Model::KeyType vs QVariant silverqx
     template<typename Model>
     quint64
@@ -881,6 +909,15 @@ namespace Tiny
                                       sequence);
     }
 
+    template<typename Model>
+    QVector<QVariant>
+    BuilderProxies<Model>::insertGetIds(
+            const QVector<QString> &columns, const QVector<QVector<QVariant>> &values,
+            const QString &sequence) const
+    {
+        return getQuery().insertGetIds(columns, values, sequence);
+    }
+
     template<typename Model>
     std::tuple<int, std::optional<QSqlQuery>>
     BuilderProxies<Model>::insertOrIgnore(const QVector<AttributeItem> &values) const
@@ -2244,6 +2281,24 @@ namespace Tiny
         return builder();
     }
 
+    /* Forward-only mode */
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::forwardOnly(const bool value)
+    {
+        getQuery().forwardOnly(value);
+        return builder();
+    }
+
+    /* Read/write connections */
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::useWriteConnection(const bool value)
+    {
+        getQuery().useWriteConnection(value);
+        return builder();
+    }
+
     /* Others proxy methods, not added to the Model and Relation */
 
     template<typename Model>
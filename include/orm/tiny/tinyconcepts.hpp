@@ -14,6 +14,11 @@ TINY_SYSTEM_HEADER
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+namespace Orm::Support
+{
+    class JsonWriter;
+}
+
 namespace Orm::Tiny
 {
 
@@ -53,10 +58,12 @@ namespace Orm::Tiny
 
     struct AttributeItem;
 
-    /*! Concept to check the container for serialized model attributes. */
+    /*! Concept to check the container for serialized model attributes (or the JSON
+        writer the model is serialized to). */
     template<typename C>
     concept SerializedAttributes = std::same_as<C, QVariantMap> ||
-                                   std::same_as<C, QVector<AttributeItem>>;
+                                   std::same_as<C, QVector<AttributeItem>> ||
+                                   std::same_as<C, Orm::Support::JsonWriter>;
 
     /* Others */
     template<typename C>
@@ -0,0 +1,194 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_ATTRIBUTESLAYOUT_HPP
+#define ORM_TINY_TYPES_ATTRIBUTESLAYOUT_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <memory>
+#include <unordered_map>
+
+#include "orm/tiny/tinytypes.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+namespace Types
+{
+
+    /*! Attribute positions keyed by the attribute name (for fast lookup), implicitly
+        shared (copy-on-write). All models hydrated from the same result set share
+        one layout because they have the same keys in the same order, the layout is
+        detached on the first modification. */
+    class AttributesLayout
+    {
+    public:
+        /*! Type used for the attribute positions. */
+        using size_type = QVector<AttributeItem>::size_type;
+        /*! The underlying hash type. */
+        using HashType = std::unordered_map<QString, size_type>;
+        /*! Constant iterator type. */
+        using const_iterator = HashType::const_iterator;
+
+        /*! Default constructor. */
+        inline AttributesLayout() = default;
+        /*! Constructor, creates the layout from the given attributes. */
+        inline explicit AttributesLayout(const QVector<AttributeItem> &attributes);
+
+        /*! Equality comparison operator for the AttributesLayout. */
+        inline bool operator==(const AttributesLayout &other) const;
+
+        /* Lookup (never detaches) */
+        /*! Determine whether the layout contains the given attribute. */
+        inline bool contains(const QString &key) const;
+        /*! Get the position of the given attribute (throws if it doesn't exist). */
+        inline size_type at(const QString &key) const;
+        /*! Find the position of the given attribute. */
+        inline const_iterator find(const QString &key) const;
+        /*! Get the constant iterator to the end. */
+        inline const_iterator end() const noexcept;
+
+        /*! Get the number of attributes in the layout. */
+        inline std::size_t size() const noexcept;
+        /*! Determine whether the layout is empty. */
+        inline bool empty() const noexcept;
+
+        /*! Get the underlying hash. */
+        inline const HashType &hash() const noexcept;
+        /*! Determine whether the layout is shared with the given layout. */
+        inline bool isSharedWith(const AttributesLayout &other) const noexcept;
+
+        /* Modifiers (detach the shared layout) */
+        /*! Insert the attribute position (does nothing if the key already exists). */
+        inline void emplace(const QString &key, size_type position);
+        /*! Remove the given attribute from the layout. */
+        inline void erase(const QString &key);
+        /*! Remove all attributes from the layout. */
+        inline void clear() noexcept;
+
+        /*! Rehash attribute positions from the given index. */
+        inline void rehash(const QVector<AttributeItem> &attributes, size_type from = 0);
+
+    private:
+        /*! Get the non-shared hash for modification, detach if shared. */
+        inline HashType &detach();
+
+        /*! The shared hash of attribute positions, nullptr if empty. */
+        std::shared_ptr<HashType> m_hash = nullptr;
+    };
+
+    /* public */
+
+    AttributesLayout::AttributesLayout(const QVector<AttributeItem> &attributes)
+        : m_hash(std::make_shared<HashType>())
+    {
+        m_hash->reserve(static_cast<std::size_t>(attributes.size()));
+
+        rehash(attributes);
+    }
+
+    bool AttributesLayout::operator==(const AttributesLayout &other) const
+    {
+        return m_hash == other.m_hash || hash() == other.hash();
+    }
+
+    /* Lookup (never detaches) */
+
+    bool AttributesLayout::contains(const QString &key) const
+    {
+        return m_hash && m_hash->contains(key);
+    }
+
+    AttributesLayout::size_type AttributesLayout::at(const QString &key) const
+    {
+        return hash().at(key);
+    }
+
+    AttributesLayout::const_iterator AttributesLayout::find(const QString &key) const
+    {
+        return hash().find(key);
+    }
+
+    AttributesLayout::const_iterator AttributesLayout::end() const noexcept
+    {
+        return hash().end();
+    }
+
+    std::size_t AttributesLayout::size() const noexcept
+    {
+        return m_hash ? m_hash->size() : 0;
+    }
+
+    bool AttributesLayout::empty() const noexcept
+    {
+        return !m_hash || m_hash->empty();
+    }
+
+    const AttributesLayout::HashType &AttributesLayout::hash() const noexcept
+    {
+        // Used by empty layouts so they don't have to allocate
+        static const HashType EmptyHash;
+
+        return m_hash ? *m_hash : EmptyHash;
+    }
+
+    bool AttributesLayout::isSharedWith(const AttributesLayout &other) const noexcept
+    {
+        return m_hash != nullptr && m_hash == other.m_hash;
+    }
+
+    /* Modifiers (detach the shared layout) */
+
+    void AttributesLayout::emplace(const QString &key, const size_type position)
+    {
+        detach().emplace(key, position);
+    }
+
+    void AttributesLayout::erase(const QString &key)
+    {
+        if (!contains(key))
+            return;
+
+        detach().erase(key);
+    }
+
+    void AttributesLayout::clear() noexcept
+    {
+        m_hash.reset();
+    }
+
+    void AttributesLayout::rehash(const QVector<AttributeItem> &attributes,
+                                  const size_type from)
+    {
+        auto &hash = detach();
+
+        for (auto i = from; i < attributes.size(); ++i)
+            // 'i' is the position index
+            hash[attributes.at(i).key] = i;
+    }
+
+    /* private */
+
+    AttributesLayout::HashType &AttributesLayout::detach()
+    {
+        if (!m_hash)
+            m_hash = std::make_shared<HashType>();
+
+        // Someone else uses this layout, make a copy before the modification
+        else if (m_hash.use_count() > 1)
+            m_hash = std::make_shared<HashType>(*m_hash);
+
+        return *m_hash;
+    }
+
+} // namespace Types
+
+    /*! Alias for the AttributesLayout. */
+    using AttributesLayout = Tiny::Types::AttributesLayout;
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_ATTRIBUTESLAYOUT_HPP
@@ -0,0 +1,178 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_CONVERSIONPLAN_HPP
+#define ORM_TINY_TYPES_CONVERSIONPLAN_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "orm/tiny/tinytypes.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+namespace Types
+{
+
+    /*! Conversion of one attribute applied when the attribute is read or serialized. */
+    struct AttributeConversion
+    {
+        /*! The attribute's cast (the cast has priority over the date conversion). */
+        std::optional<CastItem> cast = std::nullopt;
+        /*! Determine whether the attribute is listed in the model's dates. */
+        bool date = false;
+        /*! Determine whether the attribute is a date (listed in the dates or has
+            the QDate/QDateTime cast). */
+        bool dateAttribute = false;
+    };
+
+    /*! Inputs the conversion plan was computed from, used to detect a stale plan. */
+    struct ConversionPlanSource
+    {
+        /*! The model's u_dates (compared by the identity, it's implicitly shared). */
+        QStringList userDates;
+        /*! The revision of the model's u_casts. */
+        std::size_t castsRevision = 0;
+        /*! The primary key name. */
+        QString keyName;
+        /*! Determine whether the primary key is auto-incrementing (adds the key cast). */
+        bool incrementing = true;
+        /*! Determine whether the model uses timestamps (adds the timestamp dates). */
+        bool usesTimestamps = true;
+    };
+
+    /*! Cast and date conversions of all attributes of one model type, computed once
+        from the u_casts, u_dates, primary key, and timestamp columns, so reading
+        or serializing an attribute doesn't have to build these containers again. */
+    class ConversionPlan
+    {
+    public:
+        /*! Constructor. */
+        inline ConversionPlan(std::unordered_map<QString, CastItem> &&casts,
+                              QStringList &&dates, ConversionPlanSource &&source);
+
+        /*! Determine whether the plan was computed from the given inputs. */
+        inline bool
+        isComputedFrom(const QStringList &userDates, std::size_t castsRevision,
+                       const QString &keyName, bool incrementing,
+                       bool usesTimestamps) const;
+
+        /*! Get the conversion of the given attribute, nullptr if there is nothing
+            to convert. */
+        inline const AttributeConversion *find(const QString &key) const;
+
+        /*! Determine whether the given attribute has a cast. */
+        inline bool hasCast(const QString &key) const;
+        /*! Get the cast of the given attribute (throws if it doesn't have a cast). */
+        inline const CastItem &castItem(const QString &key) const;
+        /*! Determine whether the given attribute is a date (listed in the dates or has
+            the QDate/QDateTime cast). */
+        inline bool isDateAttribute(const QString &key) const;
+
+        /*! Get all casts (including the primary key cast). */
+        inline const std::unordered_map<QString, CastItem> &casts() const noexcept;
+        /*! Get all dates (including the timestamp columns). */
+        inline const QStringList &dates() const noexcept;
+
+    private:
+        /*! All casts (including the primary key cast). */
+        std::unordered_map<QString, CastItem> m_casts;
+        /*! All dates (including the timestamp columns). */
+        QStringList m_dates;
+        /*! Conversions of all attributes that have a cast or are dates. */
+        std::unordered_map<QString, AttributeConversion> m_conversions;
+        /*! Inputs the plan was computed from. */
+        ConversionPlanSource m_source;
+    };
+
+    /* public */
+
+    ConversionPlan::ConversionPlan(
+            std::unordered_map<QString, CastItem> &&casts, QStringList &&dates,
+            ConversionPlanSource &&source
+    )
+        : m_casts(std::move(casts))
+        , m_dates(std::move(dates))
+        , m_source(std::move(source))
+    {
+        m_conversions.reserve(m_casts.size() + static_cast<std::size_t>(m_dates.size()));
+
+        for (const auto &[key, castItem] : m_casts) {
+            const auto castType = castItem.type();
+
+            auto &conversion = m_conversions[key];
+            conversion.cast = castItem;
+            conversion.dateAttribute = castType == CastType::QDate ||
+                                       castType == CastType::QDateTime;
+        }
+
+        for (const auto &key : std::as_const(m_dates)) {
+            auto &conversion = m_conversions[key];
+            conversion.date = true;
+            conversion.dateAttribute = true;
+        }
+    }
+
+    bool ConversionPlan::isComputedFrom(
+            const QStringList &userDates, const std::size_t castsRevision,
+            const QString &keyName, const bool incrementing,
+            const bool usesTimestamps) const
+    {
+        /* Assigning or modifying the u_dates detaches it from the shared copy
+           in the source, so the identity check is enough. */
+        return m_source.castsRevision == castsRevision &&
+               m_source.incrementing == incrementing &&
+               m_source.usesTimestamps == usesTimestamps &&
+               m_source.userDates.isSharedWith(userDates) &&
+               m_source.keyName == keyName;
+    }
+
+    const AttributeConversion *ConversionPlan::find(const QString &key) const
+    {
+        const auto conversion = m_conversions.find(key);
+
+        return conversion == m_conversions.cend() ? nullptr : &conversion->second;
+    }
+
+    bool ConversionPlan::hasCast(const QString &key) const
+    {
+        return m_casts.contains(key);
+    }
+
+    const CastItem &ConversionPlan::castItem(const QString &key) const
+    {
+        return m_casts.at(key);
+    }
+
+    bool ConversionPlan::isDateAttribute(const QString &key) const
+    {
+        const auto *const conversion = find(key);
+
+        return conversion != nullptr && conversion->dateAttribute;
+    }
+
+    const std::unordered_map<QString, CastItem> &
+    ConversionPlan::casts() const noexcept
+    {
+        return m_casts;
+    }
+
+    const QStringList &ConversionPlan::dates() const noexcept
+    {
+        return m_dates;
+    }
+
+} // namespace Types
+
+    /*! Alias for the ConversionPlan. */
+    using ConversionPlan = Tiny::Types::ConversionPlan;
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_CONVERSIONPLAN_HPP
@@ -0,0 +1,147 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_MODELMETADATA_HPP
+#define ORM_TINY_TYPES_MODELMETADATA_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/constants.hpp"
+#include "orm/macros/threadlocal.hpp"
+#include "orm/utils/string.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+namespace Types
+{
+
+    /*! Metadata of the given model type guessed from the model's class name, every
+        value is computed once per type (demangling the class name and converting
+        it to the snake_case is expensive and the result never changes). */
+    template<typename Model>
+    class ModelMetadata
+    {
+        Q_DISABLE_COPY_MOVE(ModelMetadata)
+
+        /*! Alias for the string utils. */
+        using StringUtils = Orm::Utils::String;
+        /*! Alias for the type utils. */
+        using TypeUtils = Orm::Utils::Type;
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        ModelMetadata() = delete;
+        /*! Deleted destructor. */
+        ~ModelMetadata() = delete;
+
+        /*! Get the model's class name without the namespace (eg. TorrentPreviewFile). */
+        inline static const QString &classPureBasename();
+        /*! Get the model's class name in the camelCase (eg. torrentPreviewFile), used
+            to guess relation names. */
+        inline static const QString &camelName();
+        /*! Get the model's class name in the snake_case (eg. torrent_preview_file). */
+        inline static const QString &snakeName();
+
+        /*! Get the default table name (the pluralized snake_case class name). */
+        inline static const QString &defaultTable();
+        /*! Get the default foreign key name for the given primary key name. */
+        inline static const QString &foreignKey(const QString &keyName);
+        /*! Get the table qualified key name. */
+        inline static const QString &
+        qualifiedKeyName(const QString &table, const QString &keyName);
+    };
+
+    /* public */
+
+    template<typename Model>
+    const QString &ModelMetadata<Model>::classPureBasename()
+    {
+        static const auto cached = TypeUtils::template classPureBasename<Model>();
+
+        return cached;
+    }
+
+    template<typename Model>
+    const QString &ModelMetadata<Model>::camelName()
+    {
+        static const auto cached = []
+        {
+            auto name = classPureBasename();
+
+            if (!name.isEmpty())
+                name[0] = name[0].toLower();
+
+            return name;
+        }();
+
+        return cached;
+    }
+
+    template<typename Model>
+    const QString &ModelMetadata<Model>::snakeName()
+    {
+        static const auto cached = StringUtils::snake(classPureBasename());
+
+        return cached;
+    }
+
+    template<typename Model>
+    const QString &ModelMetadata<Model>::defaultTable()
+    {
+        static const auto cached = Orm::Constants::TMPL_PLURAL.arg(snakeName());
+
+        return cached;
+    }
+
+    template<typename Model>
+    const QString &ModelMetadata<Model>::foreignKey(const QString &keyName)
+    {
+        /* Depends on the primary key name which is the model's data member, it's
+           practically always the same for the given type so remember the last one. */
+        T_THREAD_LOCAL
+        static QString cachedKeyName;
+        T_THREAD_LOCAL
+        static QString cached;
+
+        if (cached.isEmpty() || cachedKeyName != keyName) {
+            cachedKeyName = keyName;
+            cached = QStringLiteral("%1_%2").arg(snakeName(), keyName);
+        }
+
+        return cached;
+    }
+
+    template<typename Model>
+    const QString &
+    ModelMetadata<Model>::qualifiedKeyName(const QString &table, const QString &keyName)
+    {
+        // The same as above, depends on the model's data members
+        T_THREAD_LOCAL
+        static QString cachedTable;
+        T_THREAD_LOCAL
+        static QString cachedKeyName;
+        T_THREAD_LOCAL
+        static QString cached;
+
+        if (cached.isEmpty() || cachedKeyName != keyName || cachedTable != table) {
+            cachedTable = table;
+            cachedKeyName = keyName;
+            cached = Orm::Constants::DOT_IN.arg(table, keyName);
+        }
+
+        return cached;
+    }
+
+} // namespace Types
+
+    /*! Alias for the ModelMetadata. */
+    template<typename Model>
+    using ModelMetadata = Tiny::Types::ModelMetadata<Model>;
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_MODELMETADATA_HPP
@@ -18,6 +18,7 @@ TINY_SYSTEM_HEADER
 #include <range/v3/view/transform.hpp>
 
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/support/jsonwriter.hpp"
 #include "orm/tiny/utils/attribute.hpp"
 #include "orm/utils/type.hpp"
 
@@ -27,6 +28,10 @@ namespace Orm
 {
 namespace Tiny
 {
+namespace Relations
+{
+    class IsPivotModel;
+}
 namespace Types
 {
 
@@ -429,6 +434,20 @@ namespace Types
         /*! Load a set of relationships onto the collection. */
         inline ModelsCollection &load(QVector<QString> &&relations) &&;
 
+        /* Collection - Saving related */
+        /*! Save all the models in one transaction, models with the same table and
+            columns are inserted or updated by one query. */
+        template<typename = void>
+        bool saveAll(SaveOptions options = {});
+        /*! Insert the models or update the existing ones by the unique columns,
+            returns the number of affected rows (models' state is not changed). */
+        template<typename = void>
+        qint64 upsert(const QStringList &uniqueBy, const QStringList &update);
+        /*! Insert the models or update the existing ones by the unique columns
+            (update all columns). */
+        template<typename = void>
+        qint64 upsert(const QStringList &uniqueBy);
+
         /* EnumeratesValues */
         /*! Get the vector of models as a attributes vector with serialized models. */
         template<typename PivotType = void> // PivotType is primarily internal
@@ -457,6 +476,20 @@ namespace Types
         inline QByteArray
         toJson(QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
 
+        /*! Write a collection as JSON to the given buffer (appends to it), without
+            the intermediate QVariantMap-s and QJsonArray. */
+        template<typename PivotType = void> // PivotType is primarily internal
+        void writeJson(QByteArray &json,
+                       QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+        /*! Write a collection as JSON to the given device, without the intermediate
+            QVariantMap-s and QJsonArray. */
+        template<typename PivotType = void> // PivotType is primarily internal
+        bool writeJson(QIODevice &device,
+                       QJsonDocument::JsonFormat format = QJsonDocument::Compact) const;
+        /*! Write a collection to the given JSON writer. */
+        template<typename PivotType = void> // PivotType is primarily internal
+        void serializeToJson(Orm::Support::JsonWriter &writer) const;
+
         /*! Create a collection of all models that do not pass a given truth test. */
         ModelsCollection<ModelRawType *>
         reject(const std::function<bool(ModelRawType *, size_type)> &callback);
@@ -593,6 +626,20 @@ namespace Types
 
         /*! Throw if the given operator is not valid for the where() method. */
         static void throwIfInvalidWhereOperator(const QString &comparison);
+
+        /*! Insert the new models, one multi-row insert for the same table and
+            columns. */
+        static void insertModelsForSaveAll(const QVector<ModelRawType *> &models);
+        /*! Update the dirty models, one update for the same table and dirty
+            columns. */
+        static void updateModelsForSaveAll(const QVector<ModelRawType *> &models);
+        /*! Upsert the models, one upsert for the same table and columns, common
+            code. */
+        template<typename = void>
+        qint64 upsertInternal(const QStringList &uniqueBy,
+                              const std::optional<QStringList> &update);
+        /*! Throw if the models in the collection use different connections. */
+        void throwIfDifferentConnections() const;
     };
 
     /* public */
@@ -1841,6 +1888,142 @@ namespace Types
         return load(WithItem::fromStringVector(std::move(relations)));
     }
 
+    /* Collection - Saving related */
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    bool ModelsCollection<Model>::saveAll(const SaveOptions options)
+    {
+        // Nothing to do
+        if (this->isEmpty())
+            return true;
+
+        throwIfDifferentConnections();
+
+        // Don't handle the nullptr
+        // Ownership of a unique_ptr()
+        const auto builder = toPointer(first())->newModelQuery();
+        auto &connection = builder->getConnection();
+
+        // Don't start the transaction if we are already in it
+        const auto useTransaction = !connection.inTransaction();
+
+        /*! Model state changed by the saveAll() before the transaction is committed. */
+        struct ModelSnapshot
+        {
+            /*! The saved model. */
+            ModelRawType *model;
+            /*! The model attributes (the generated key and timestamps). */
+            QVector<AttributeItem> attributes;
+            /*! The model original attributes (pivot models are synced by the save()). */
+            QVector<AttributeItem> original;
+            /*! Determine whether the model exists. */
+            bool exists;
+        };
+
+        /* The models' state is restored if anything fails, so the rolled back models
+           don't claim they exist, the attributes are implicitly shared so the snapshot
+           is cheap. */
+        std::vector<ModelSnapshot> snapshots;
+        snapshots.reserve(static_cast<std::size_t>(this->size()));
+
+        for (ModelLoopType model : *this) {
+            auto *const modelPointer = toPointer(model);
+
+            snapshots.push_back({modelPointer, modelPointer->getAttributes(),
+                                 modelPointer->getRawOriginals(), modelPointer->exists});
+        }
+
+        if (useTransaction)
+            connection.beginTransaction();
+
+        QVector<ModelRawType *> savedModels;
+        savedModels.reserve(this->size());
+        QVector<ModelRawType *> updatedModels;
+
+        try {
+            /* Pivot models are keyed by the foreign keys instead of the primary key,
+               they are saved one by one, but still in the same transaction. */
+            if constexpr (std::is_base_of_v<Relations::IsPivotModel, ModelRawType>)
+                for (ModelLoopType model : *this)
+                    toPointer(model)->save(options);
+
+            else {
+                QVector<ModelRawType *> newModels;
+                QVector<ModelRawType *> dirtyModels;
+
+                for (ModelLoopType model : *this) {
+                    auto *const modelPointer = toPointer(model);
+
+                    if (!modelPointer->exists)
+                        newModels << modelPointer;
+                    else if (modelPointer->isDirty())
+                        dirtyModels << modelPointer;
+                }
+
+                insertModelsForSaveAll(newModels);
+                updateModelsForSaveAll(dirtyModels);
+
+                savedModels << newModels << dirtyModels;
+                updatedModels = std::move(dirtyModels);
+
+                /* The same as the Model::finishSave(), but every owner is touched only
+                   once, even if many of the saved models belong to it. */
+                if (options.touch) {
+                    std::unordered_set<QString> touched;
+
+                    for (auto *const model : std::as_const(savedModels))
+                        if (model->isDirty())
+                            model->touchOwners(touched);
+                }
+            }
+
+        } catch (...) {
+            if (useTransaction)
+                connection.rollBack();
+
+            for (auto &&[model, attributes, original, exists] : snapshots) {
+                model->setRawAttributes(original, true)
+                      .setRawAttributes(std::move(attributes));
+
+                model->exists = exists;
+            }
+
+            throw;
+        }
+
+        if (useTransaction)
+            connection.commit();
+
+        // The same as the Model::performUpdate(), changes are synced after the update
+        for (auto *const model : std::as_const(updatedModels))
+            model->syncChanges();
+
+        for (auto *const model : std::as_const(savedModels)) {
+            if (model->getConnectionName().isEmpty())
+                model->setConnection(connection.getName());
+
+            model->syncOriginal();
+        }
+
+        return true;
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    qint64 ModelsCollection<Model>::upsert(const QStringList &uniqueBy,
+                                           const QStringList &update)
+    {
+        return upsertInternal(uniqueBy, update);
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    qint64 ModelsCollection<Model>::upsert(const QStringList &uniqueBy)
+    {
+        return upsertInternal(uniqueBy, std::nullopt);
+    }
+
     /* EnumeratesValues */
 
     template<DerivedCollectionModel Model>
@@ -1947,6 +2130,42 @@ namespace Types
         return toJsonDocument<PivotType>().toJson(format);
     }
 
+    template<DerivedCollectionModel Model>
+    template<typename PivotType>
+    void ModelsCollection<Model>::writeJson(
+            QByteArray &json, const QJsonDocument::JsonFormat format) const
+    {
+        Orm::Support::JsonWriter writer(json, format);
+
+        serializeToJson<PivotType>(writer);
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename PivotType>
+    bool ModelsCollection<Model>::writeJson(
+            QIODevice &device, const QJsonDocument::JsonFormat format) const
+    {
+        Orm::Support::JsonWriter writer(device, format);
+
+        serializeToJson<PivotType>(writer);
+
+        return writer.flush();
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename PivotType>
+    void
+    ModelsCollection<Model>::serializeToJson(Orm::Support::JsonWriter &writer) const
+    {
+        writer.beginArray();
+
+        // No model copies, every model is written directly to the writer
+        for (ConstModelLoopType model : *this)
+            toPointer(model)->template serializeToJson<PivotType>(writer);
+
+        writer.endArray();
+    }
+
     template<DerivedCollectionModel Model>
     ModelsCollection<typename ModelsCollection<Model>::ModelRawType *>
     ModelsCollection<Model>::reject(
@@ -2427,6 +2646,278 @@ namespace Types
 
     }
 
+    template<DerivedCollectionModel Model>
+    void ModelsCollection<Model>::insertModelsForSaveAll(
+            const QVector<ModelRawType *> &models)
+    {
+        /*! New models with the same table and columns. */
+        struct InsertGroup
+        {
+            /*! Inserted columns. */
+            QVector<QString> columns;
+            /*! Inserted rows, one row for every model. */
+            QVector<QVector<QVariant>> values;
+            /*! Inserted models. */
+            QVector<ModelRawType *> models;
+        };
+
+        QVector<InsertGroup> groups;
+        std::unordered_map<QString,
+                           typename QVector<InsertGroup>::size_type> groupIndexes;
+
+        for (auto *const model : models) {
+            /* The same as the Model::performInsert(), touch the creation and update
+               timestamps before the attributes are inserted. */
+            if (model->usesTimestamps())
+                model->updateTimestamps();
+
+            const auto &attributes = model->getAttributes();
+
+            auto groupKey = model->getTable();
+
+            for (const auto &attribute : attributes)
+                groupKey += QChar(u'\x1F') + attribute.key;
+
+            auto [itGroupIndex, inserted] = groupIndexes.try_emplace(std::move(groupKey),
+                                                                     groups.size());
+            if (inserted) {
+                InsertGroup group;
+                group.columns.reserve(attributes.size());
+                for (const auto &attribute : attributes)
+                    group.columns << attribute.key;
+
+                groups << std::move(group);
+            }
+
+            auto &group = groups[itGroupIndex->second];
+
+            QVector<QVariant> row;
+            row.reserve(attributes.size());
+            for (const auto &attribute : attributes)
+                row << attribute.value;
+
+            group.values << std::move(row);
+            group.models << model;
+        }
+
+        for (const auto &group : std::as_const(groups)) {
+            auto *const firstModel = group.models.constFirst();
+            const auto &keyName = firstModel->getKeyName();
+
+            // Ownership of a unique_ptr()
+            const auto query = firstModel->newModelQuery();
+
+            /* If the table isn't incrementing, insert all the rows by the multi-row
+               inserts, the same as the Model::performInsert() nothing is inserted
+               if there are no attributes. */
+            if (!firstModel->getIncrementing()) {
+                if (!group.columns.isEmpty())
+                    query->getQuery().insertBatched(group.columns, group.values);
+            }
+
+            /* Generated keys of all rows inserted by one statement are obtained using
+               the returning clause, they are assigned in the order of the rows. */
+            else if (!group.columns.isEmpty() &&
+                     query->getConnection().getQueryGrammar().supportsInsertReturning()
+            ) {
+                const auto ids = query->getQuery().insertGetIds(group.columns,
+                                                                group.values, keyName);
+
+                Q_ASSERT(ids.size() == group.models.size());
+
+                for (typename QVector<QVariant>::size_type index = 0;
+                     index < ids.size(); ++index
+                )
+                    group.models.at(index)->setAttribute(keyName, ids.at(index));
+            }
+
+            /* The database can't return the generated keys of all the inserted rows
+               (MySQL, SQLite), insert every model alone, but in the same transaction. */
+            else
+                for (auto *const model : group.models)
+                    // Insert was successful, the same as the Model::insertAndSetId()
+                    if (const auto id = query->insertGetId(model->getAttributes(),
+                                                           keyName);
+                        id != 0
+                    )
+                        model->setAttribute(keyName, id);
+
+            for (auto *const model : group.models)
+                model->exists = true;
+        }
+    }
+
+    template<DerivedCollectionModel Model>
+    void ModelsCollection<Model>::updateModelsForSaveAll(
+            const QVector<ModelRawType *> &models)
+    {
+        /*! Dirty models with the same table and dirty columns. */
+        struct UpdateGroup
+        {
+            /*! Updated columns, the primary key is the first column. */
+            QVector<QString> columns;
+            /*! Updated rows, one row for every model. */
+            QVector<QVector<QVariant>> values;
+            /*! Updated models. */
+            QVector<ModelRawType *> models;
+        };
+
+        QVector<UpdateGroup> groups;
+        std::unordered_map<QString,
+                           typename QVector<UpdateGroup>::size_type> groupIndexes;
+
+        for (auto *const model : models) {
+            // The same as the Model::performUpdate(), touch the update timestamp
+            if (model->usesTimestamps())
+                model->updateTimestamps();
+
+            const auto dirty = model->getDirty();
+
+            auto groupKey = model->getTable();
+
+            for (const auto &attribute : dirty)
+                groupKey += QChar(u'\x1F') + attribute.key;
+
+            auto [itGroupIndex, inserted] = groupIndexes.try_emplace(std::move(groupKey),
+                                                                     groups.size());
+            if (inserted) {
+                UpdateGroup group;
+                group.columns.reserve(dirty.size() + 1);
+                group.columns << model->getKeyName();
+                for (const auto &attribute : dirty)
+                    group.columns << attribute.key;
+
+                groups << std::move(group);
+            }
+
+            auto &group = groups[itGroupIndex->second];
+
+            QVector<QVariant> row;
+            row.reserve(dirty.size() + 1);
+            row << model->getKeyForSaveQuery();
+            for (const auto &attribute : dirty)
+                row << attribute.value;
+
+            group.values << std::move(row);
+            group.models << model;
+        }
+
+        for (const auto &group : std::as_const(groups)) {
+            auto *const firstModel = group.models.constFirst();
+
+            // Ownership of a unique_ptr()
+            firstModel->newModelQuery()->getQuery()
+                    .updateBatch(group.columns, group.values, firstModel->getKeyName());
+        }
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename>
+    qint64 ModelsCollection<Model>::upsertInternal(
+            const QStringList &uniqueBy, const std::optional<QStringList> &update)
+    {
+        // Nothing to do
+        if (this->isEmpty())
+            return 0;
+
+        throwIfDifferentConnections();
+
+        /*! Models with the same table and columns. */
+        struct UpsertGroup
+        {
+            /*! Upserted rows, one row for every model. */
+            QVector<QVariantMap> values;
+            /*! Model used to create the query. */
+            ModelRawType *model = nullptr;
+        };
+
+        QVector<UpsertGroup> groups;
+        std::unordered_map<QString,
+                           typename QVector<UpsertGroup>::size_type> groupIndexes;
+
+        for (ModelLoopType model : *this) {
+            auto *const modelPointer = toPointer(model);
+
+            // Attributes are already prepared by the Model::setAttribute()
+            auto row = AttributeUtils::convertVectorToMap(modelPointer->getAttributes());
+
+            /* The TinyBuilder::upsert() adds missing timestamps only, the update
+               timestamp of already saved models has to be refreshed. */
+            if (modelPointer->usesTimestamps())
+                if (const auto &updatedAtColumn = modelPointer->getUpdatedAtColumn();
+                    !updatedAtColumn.isEmpty()
+                )
+                    row.insert(updatedAtColumn, modelPointer->freshTimestampString());
+
+            // Columns are obtained only from a first QMap (grammar's compileUpsert())
+            auto groupKey = modelPointer->getTable();
+
+            for (auto itColumn = row.constKeyValueBegin();
+                 itColumn != row.constKeyValueEnd(); ++itColumn
+            )
+                groupKey += QChar(u'\x1F') + itColumn->first;
+
+            auto [itGroupIndex, inserted] = groupIndexes.try_emplace(std::move(groupKey),
+                                                                     groups.size());
+            if (inserted) {
+                UpsertGroup group;
+                group.model = modelPointer;
+
+                groups << std::move(group);
+            }
+
+            groups[itGroupIndex->second].values << std::move(row);
+        }
+
+        // Ownership of a unique_ptr()
+        const auto builder = groups.constFirst().model->newModelQuery();
+        auto &connection = builder->getConnection();
+
+        // Don't start the transaction if there is only one group or we are already in it
+        const auto useTransaction = groups.size() > 1 && !connection.inTransaction();
+
+        if (useTransaction)
+            connection.beginTransaction();
+
+        qint64 affected = 0;
+
+        try {
+            for (const auto &group : std::as_const(groups)) {
+                // Ownership of a unique_ptr()
+                const auto query = group.model->newModelQuery();
+
+                affected += std::get<0>(
+                                update ? query->upsert(group.values, uniqueBy, *update)
+                                       : query->upsert(group.values, uniqueBy));
+            }
+
+        } catch (...) {
+            if (useTransaction)
+                connection.rollBack();
+
+            throw;
+        }
+
+        if (useTransaction)
+            connection.commit();
+
+        return affected;
+    }
+
+    template<DerivedCollectionModel Model>
+    void ModelsCollection<Model>::throwIfDifferentConnections() const
+    {
+        // Don't handle the nullptr
+        const auto &connectionName = toPointer(first())->getConnectionName();
+
+        for (ConstModelLoopType model : *this)
+            if (toPointer(model)->getConnectionName() != connectionName)
+                throw Orm::Exceptions::InvalidArgumentError(
+                        QStringLiteral("All the models in the collection have to use "
+                                       "the same connection in %1().")
+                        .arg(__tiny_func__));
+    }
+
 } // namespace Types
 
     /*! Alias for the WhereBetweenCollectionItem. */
@@ -0,0 +1,151 @@
+#pragma once
+#ifndef ORM_TYPES_BINDINGSMAP_HPP
+#define ORM_TYPES_BINDINGSMAP_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+#include <QVector>
+
+#include <array>
+#include <span>
+
+#include "orm/macros/export.hpp"
+#include "orm/ormtypes.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Query value bindings, all bindings are stored in one contiguous vector ordered
+        by the binding type and every binding type has its own range in this vector,
+        so the final bindings don't have to be flattened. */
+    class SHAREDLIB_EXPORT BindingsMap
+    {
+    public:
+        /*! Alias for the size type. */
+        using size_type = QVector<QVariant>::size_type;
+
+        /*! Number of binding types. */
+        constexpr static std::size_t TypesCount =
+                static_cast<std::size_t>(BindingType::UNIONORDER) + 1;
+
+        /*! Get the bindings of the given type (the view is invalidated by any change). */
+        inline std::span<const QVariant> at(BindingType type) const;
+        /*! Get the copy of the bindings of the given type. */
+        inline QVector<QVariant> value(BindingType type) const;
+        /*! Get all the bindings ordered by the binding type. */
+        inline const QVector<QVariant> &all() const noexcept;
+
+        /*! Get the number of bindings of the given type. */
+        inline size_type size(BindingType type) const;
+        /*! Get the number of all bindings. */
+        inline size_type size() const noexcept;
+        /*! Determine whether the given binding type is valid. */
+        constexpr static bool contains(BindingType type) noexcept;
+
+        /*! Append the binding to the bindings of the given type. */
+        void append(BindingType type, const QVariant &binding);
+        /*! Append the binding to the bindings of the given type. */
+        void append(BindingType type, QVariant &&binding);
+        /*! Append the bindings to the bindings of the given type (the bindings can't be
+            a view of this instance). */
+        void append(BindingType type, std::span<const QVariant> bindings);
+        /*! Append the bindings to the bindings of the given type. */
+        inline void append(BindingType type, const QVector<QVariant> &bindings);
+        /*! Append the bindings to the bindings of the given type. */
+        void append(BindingType type, QVector<QVariant> &&bindings);
+        /*! Replace the bindings of the given type. */
+        void set(BindingType type, QVector<QVariant> &&bindings);
+        /*! Remove all the bindings of the given type. */
+        void clear(BindingType type);
+
+    private:
+        /*! Get the index of the given binding type. */
+        constexpr static std::size_t index(BindingType type) noexcept;
+        /*! Get the offset of the first binding of the given type. */
+        inline size_type beginOffset(BindingType type) const;
+        /*! Get the offset after the last binding of the given type. */
+        inline size_type endOffset(BindingType type) const;
+
+        /*! Move the bindings appended to the end of the vector to the end of the given
+            binding type range and shift the ranges of the following types. */
+        void finishAppend(BindingType type, size_type oldSize);
+
+        /*! All the bindings ordered by the binding type. */
+        QVector<QVariant> m_bindings;
+        /*! Offsets of the first binding of every binding type, the last offset is
+            the number of all bindings. */
+        std::array<size_type, TypesCount + 1> m_offsets {};
+    };
+
+    /* public */
+
+    std::span<const QVariant> BindingsMap::at(const BindingType type) const
+    {
+        return {m_bindings.constData() + beginOffset(type),
+                static_cast<std::size_t>(size(type))};
+    }
+
+    QVector<QVariant> BindingsMap::value(const BindingType type) const
+    {
+        return m_bindings.mid(beginOffset(type), size(type));
+    }
+
+    const QVector<QVariant> &BindingsMap::all() const noexcept
+    {
+        return m_bindings;
+    }
+
+    void BindingsMap::append(const BindingType type, const QVector<QVariant> &bindings)
+    {
+        append(type, std::span<const QVariant>(bindings.constData(),
+                                               static_cast<std::size_t>(bindings.size())));
+    }
+
+    BindingsMap::size_type BindingsMap::size(const BindingType type) const
+    {
+        return endOffset(type) - beginOffset(type);
+    }
+
+    BindingsMap::size_type BindingsMap::size() const noexcept
+    {
+        return m_bindings.size();
+    }
+
+    constexpr bool BindingsMap::contains(const BindingType type) noexcept
+    {
+        return index(type) < TypesCount;
+    }
+
+    /* private */
+
+    constexpr std::size_t BindingsMap::index(const BindingType type) noexcept
+    {
+        return static_cast<std::size_t>(type);
+    }
+
+    BindingsMap::size_type BindingsMap::beginOffset(const BindingType type) const
+    {
+        return m_offsets.at(index(type));
+    }
+
+    BindingsMap::size_type BindingsMap::endOffset(const BindingType type) const
+    {
+        return m_offsets.at(index(type) + 1);
+    }
+
+} // namespace Types
+
+    /*! Alias for the BindingsMap. */
+    using BindingsMap = Types::BindingsMap;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_BINDINGSMAP_HPP
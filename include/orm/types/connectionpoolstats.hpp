@@ -0,0 +1,63 @@
+#pragma once
+#ifndef ORM_TYPES_CONNECTIONPOOLSTATS_HPP
+#define ORM_TYPES_CONNECTIONPOOLSTATS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Connection pool statistics (a snapshot). */
+    struct ConnectionPoolStats
+    {
+        /*! Maximum number of physical connections. */
+        qint64 maxSize = 0;
+        /*! Opened physical connections (leased, idle, and currently opening). */
+        qint64 size = 0;
+        /*! Physical connections leased to threads. */
+        qint64 leased = 0;
+        /*! Idle physical connections. */
+        qint64 idle = 0;
+        /*! Leased connections divided by the maximum number of connections. */
+        double utilization = 0.0;
+
+        /*! Number of acquired connections. */
+        qint64 acquired = 0;
+        /*! Number of acquisitions that had to wait for a released connection. */
+        qint64 waited = 0;
+        /*! Number of acquisitions that timed out. */
+        qint64 timeouts = 0;
+        /*! Total time in milliseconds spent waiting for a connection. */
+        qint64 waitTime = 0;
+        /*! The longest time in milliseconds spent waiting for a connection. */
+        qint64 maxWaitTime = 0;
+
+        /*! Number of opened physical connections. */
+        qint64 opened = 0;
+        /*! Number of closed physical connections (evicted or broken). */
+        qint64 closed = 0;
+        /*! Number of idle connections closed by the idle timeout. */
+        qint64 evicted = 0;
+        /*! Number of connections that failed the health check. */
+        qint64 failedHealthChecks = 0;
+    };
+
+} // namespace Types
+
+    /*! Alias for the ConnectionPoolStats. */
+    using ConnectionPoolStats = Types::ConnectionPoolStats;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_CONNECTIONPOOLSTATS_HPP
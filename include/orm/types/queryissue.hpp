@@ -0,0 +1,59 @@
+#pragma once
+#ifndef ORM_TYPES_QUERYISSUE_HPP
+#define ORM_TYPES_QUERYISSUE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+#include <QVector>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Problem found by the query analyzer. */
+    struct QueryIssue
+    {
+        /*! Type of the found problem. */
+        enum struct Type
+        {
+            /*! The query execution time exceeded the slow query threshold. */
+            SLOW_QUERY,
+            /*! The same query was executed many times in a row with different
+                bindings (typically lazy loading of relationships in a loop). */
+            N_PLUS_ONE,
+        };
+
+        /*! Type of the found problem. */
+        Type type = Type::SLOW_QUERY;
+        /*! Connection name. */
+        QString connection;
+        /*! Executed query (the last one for the N+1 problem). */
+        QString query;
+        /*! Normalized query (literals replaced by ?, lists collapsed). */
+        QString fingerprint;
+        /*! Bound values of the executed query (the last one for the N+1 problem). */
+        QVector<QVariant> boundValues;
+        /*! Query execution time in milliseconds (all repeated queries for
+            the N+1 problem). */
+        qint64 elapsed = -1;
+        /*! Number of executed queries (repeated queries for the N+1 problem). */
+        qint64 count = 1;
+    };
+
+} // namespace Types
+
+    /*! Alias for the QueryIssue. */
+    using QueryIssue = Types::QueryIssue;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_QUERYISSUE_HPP
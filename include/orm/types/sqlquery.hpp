@@ -6,6 +6,7 @@
 TINY_SYSTEM_HEADER
 
 #include <QtSql/QSqlQuery>
+#include <QtSql/QSqlRecord>
 
 #include <optional>
 
@@ -31,6 +32,15 @@ namespace Types
         using QueryGrammar = Query::Grammars::Grammar;
 
     public:
+        /*! Conversion of the column value (resolved once per result set). */
+        enum struct ValueConversion
+        {
+            /*! Return the value as it is. */
+            NONE,
+            /*! Prepare the QDateTime/QDate and fix its time zone. */
+            DATETIME,
+        };
+
         /*! Deleted default constructor (not needed). */
         inline SqlQuery() = delete;
         /*! Default destructor. */
@@ -54,6 +64,13 @@ namespace Types
         inline QVariant value(int index) const;
         /*! Return the value of the field called name in the current record. */
         inline QVariant value(const QString &name) const;
+        /*! Return the value of field index in the current record using the given
+            column conversion (obtained from the valueConversions()). */
+        inline QVariant value(int index, ValueConversion conversion) const;
+
+        /*! Resolve the value conversion for every column of the given record, used
+            to avoid determining the conversion for every value. */
+        QVector<ValueConversion> valueConversions(const QSqlRecord &record) const;
 
     private:
         /*! Common value() method that correctly handles QDateTime's time zone. */
@@ -61,6 +78,11 @@ namespace Types
 
         /*! Determine whether it should try to convert to the QDateTime/QDate. */
         bool shouldPrepareDateTime(const QVariant &value) const;
+        /*! Determine whether values of the given column type can be converted
+            to the QDateTime/QDate. */
+        bool canPrepareDateTime(int typeId) const;
+        /*! Get the type ID of the given field (Qt5/6 compatible). */
+        static int fieldTypeId(const QSqlField &field);
 
         /*! Prepare a value as QDateTime or QDate. */
         std::optional<std::variant<QDateTime, QDate>>
@@ -95,6 +117,14 @@ namespace Types
         return valueInternal(QSqlQuery::value(name));
     }
 
+    QVariant SqlQuery::value(const int index, const ValueConversion conversion) const
+    {
+        if (conversion == ValueConversion::NONE)
+            return QSqlQuery::value(index);
+
+        return valueInternal(QSqlQuery::value(index));
+    }
+
 } // namespace Types
 
     using SqlQuery = Types::SqlQuery;
@@ -0,0 +1,71 @@
+#pragma once
+#ifndef ORM_TYPES_STATEMENTLATENCY_HPP
+#define ORM_TYPES_STATEMENTLATENCY_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include <vector>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Type of the executed statement. */
+    enum struct StatementType : quint8
+    {
+        /*! Select statements. */
+        Select,
+        /*! Affecting statements (UPDATE, INSERT, DELETE) and general statements. */
+        Affecting,
+        /*! Transactional statements (START TRANSACTION, ROLLBACK, COMMIT, SAVEPOINT). */
+        Transaction,
+    };
+
+    /*! Latency histogram of one statement fingerprint (a snapshot), all times are
+        in microseconds. */
+    struct StatementLatency
+    {
+        /*! Normalized SQL query (literals replaced by ?, lists collapsed). */
+        QString fingerprint;
+        /*! Type of the statement. */
+        StatementType type = StatementType::Select;
+
+        /*! Number of executed statements. */
+        qint64 count = 0;
+        /*! Total execution time. */
+        qint64 totalTime = 0;
+        /*! The longest execution time. */
+        qint64 maxTime = 0;
+
+        /*! Median execution time (the upper bound of the histogram bucket). */
+        qint64 p50 = 0;
+        /*! 90th percentile execution time (the upper bound of the histogram bucket). */
+        qint64 p90 = 0;
+        /*! 99th percentile execution time (the upper bound of the histogram bucket). */
+        qint64 p99 = 0;
+
+        /*! Number of statements in every histogram bucket, the bucket i contains
+            execution times lower than 2^i microseconds (the last one is unbounded). */
+        std::vector<qint64> buckets;
+    };
+
+} // namespace Types
+
+    /*! Alias for the StatementType. */
+    using StatementType = Types::StatementType;
+    /*! Alias for the StatementLatency. */
+    using StatementLatency = Types::StatementLatency;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_STATEMENTLATENCY_HPP
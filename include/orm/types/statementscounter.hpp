@@ -26,9 +26,21 @@ namespace Types
         int transactional = -1;
     };
 
+    /*! Prepared statements cache counter. */
+    struct PreparedStatementsCacheCounter
+    {
+        /*! Prepared statements obtained from the cache (only re-bound and executed). */
+        int hits = -1;
+        /*! Prepared statements that were not found in the cache (prepared again). */
+        int misses = -1;
+        /*! Least recently used prepared statements removed from the full cache. */
+        int evictions = -1;
+    };
+
 } // namespace Types
 
     using StatementsCounter = Types::StatementsCounter;
+    using PreparedStatementsCacheCounter = Types::PreparedStatementsCacheCounter;
 
 } // namespace Orm
 
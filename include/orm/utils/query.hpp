@@ -7,6 +7,8 @@ TINY_SYSTEM_HEADER
 
 #include <QVariant>
 
+#include <optional>
+
 #include "orm/constants.hpp"
 #include "orm/macros/commonnamespace.hpp"
 #include "orm/macros/export.hpp"
@@ -59,6 +61,10 @@ namespace Orm::Utils
         [[maybe_unused]]
         static void logExecutedQuery(const QSqlQuery &query);
 
+        /*! Normalize the SQL query, literals are replaced by the ? and lists of
+            placeholders are collapsed (groups the same query shapes). */
+        static QString fingerprint(const QString &queryString);
+
         /*! Prepare the passed containers for the multi-insert. */
         static QVector<QVariantMap>
         zipForInsert(const QVector<QString> &columns,
@@ -66,6 +72,14 @@ namespace Orm::Utils
 
         /*! Returns the size of the result (number of rows returned). */
         static int queryResultSize(QSqlQuery &query);
+        /*! Returns the size of the result if it's known without fetching the whole
+            result set (QuerySize driver feature), otherwise the limit as an upper
+            bound (capped to the SizeHintLimitMax) or std::nullopt. */
+        static std::optional<int>
+        queryResultSizeHint(const QSqlQuery &query, qint64 limit = -1);
+
+        /*! Maximum size hint obtained from the query limit (avoids huge reserve). */
+        constexpr static int SizeHintLimitMax = 1000;
     };
 
     /* public */
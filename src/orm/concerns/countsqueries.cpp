@@ -109,12 +109,101 @@ DatabaseConnection &CountsQueries::resetStatementsCounter()
     return databaseConnection();
 }
 
+const PreparedStatementsCacheCounter &
+CountsQueries::getPreparedStatementsCacheCounter() const
+{
+    return m_preparedStatementsCacheCounter;
+}
+
+PreparedStatementsCacheCounter CountsQueries::takePreparedStatementsCacheCounter()
+{
+    // Disabled prepared statements cache
+    if (m_preparedStatementsCacheCounter.hits == -1)
+        return {};
+
+    const auto counter = m_preparedStatementsCacheCounter;
+
+    m_preparedStatementsCacheCounter.hits      = 0;
+    m_preparedStatementsCacheCounter.misses    = 0;
+    m_preparedStatementsCacheCounter.evictions = 0;
+
+    return counter;
+}
+
+DatabaseConnection &CountsQueries::resetPreparedStatementsCacheCounter()
+{
+    // Disabled prepared statements cache, all counters have to stay -1
+    if (m_preparedStatementsCacheCounter.hits != -1) {
+        m_preparedStatementsCacheCounter.hits      = 0;
+        m_preparedStatementsCacheCounter.misses    = 0;
+        m_preparedStatementsCacheCounter.evictions = 0;
+    }
+
+    return databaseConnection();
+}
+
+bool CountsQueries::countingLatencies() const
+{
+    return m_countingLatencies;
+}
+
+DatabaseConnection &CountsQueries::enableLatencyHistograms()
+{
+    m_countingLatencies = true;
+
+    return databaseConnection();
+}
+
+DatabaseConnection &CountsQueries::disableLatencyHistograms()
+{
+    m_countingLatencies = false;
+
+    m_latencyHistograms.clear();
+
+    return databaseConnection();
+}
+
+std::vector<StatementLatency> CountsQueries::getLatencyHistograms() const
+{
+    return m_latencyHistograms.statements();
+}
+
+std::vector<StatementLatency> CountsQueries::takeLatencyHistograms()
+{
+    auto statements = m_latencyHistograms.statements();
+
+    m_latencyHistograms.clear();
+
+    return statements;
+}
+
+DatabaseConnection &CountsQueries::resetLatencyHistograms()
+{
+    m_latencyHistograms.clear();
+
+    return databaseConnection();
+}
+
+/* protected */
+
+void CountsQueries::hitLatencyHistogram(const QString &queryString,
+                                        const StatementType type, const qint64 nsecs)
+{
+    m_latencyHistograms.record(queryString, type, nsecs);
+}
+
 /* private */
 
 std::optional<qint64>
-CountsQueries::hitTransactionalCounters(const QElapsedTimer timer,
+CountsQueries::hitTransactionalCounters(const QString &queryString,
+                                        const QElapsedTimer timer,
                                         const bool countElapsed)
 {
+    // Statements latency histograms (the timer isn't started in the pretend mode)
+    if (m_countingLatencies && timer.isValid())
+        hitLatencyHistogram(queryString, StatementType::Transaction,
+                            timer.nsecsElapsed());
+
     std::optional<qint64> elapsed;
 
     if (countElapsed) {
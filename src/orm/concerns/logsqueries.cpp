@@ -1,5 +1,7 @@
 #include "orm/concerns/logsqueries.hpp"
 
+#include <algorithm>
+
 #ifdef TINYORM_DEBUG_SQL
 #  include <QDebug>
 #endif
@@ -32,7 +34,7 @@ void LogsQueries::logQueryForPretend(
 #endif
 {
     if (m_loggingQueries && m_queryLog)
-        m_queryLog->append({query, preparedBindings, Log::Type::NORMAL, ++m_queryLogId});
+        appendToQueryLog({query, preparedBindings, Log::Type::NORMAL, ++m_queryLogId});
 
 #ifdef TINYORM_DEBUG_SQL
     // Debugging SQL queries is disabled
@@ -53,8 +55,8 @@ void LogsQueries::logTransactionQuery(
         const QString &query, const std::optional<qint64> elapsed) const
 {
     if (m_loggingQueries && m_queryLog)
-        m_queryLog->append({query, {}, Log::Type::TRANSACTION, ++m_queryLogId,
-                            elapsed ? *elapsed : -1});
+        appendToQueryLog({query, {}, Log::Type::TRANSACTION, ++m_queryLogId,
+                          elapsed ? *elapsed : -1});
 
 #ifdef TINYORM_DEBUG_SQL
     // Debugging SQL queries is disabled
@@ -75,7 +77,7 @@ void LogsQueries::logTransactionQuery(
 void LogsQueries::logTransactionQueryForPretend(const QString &query) const
 {
     if (m_loggingQueries && m_queryLog)
-        m_queryLog->append({query, {}, Log::Type::TRANSACTION, ++m_queryLogId});
+        appendToQueryLog({query, {}, Log::Type::TRANSACTION, ++m_queryLogId});
 
 #ifdef TINYORM_DEBUG_SQL
     // Debugging SQL queries is disabled
@@ -90,6 +92,14 @@ void LogsQueries::logTransactionQueryForPretend(const QString &query) const
 #endif
 }
 
+std::shared_ptr<QVector<Log>> LogsQueries::getQueryLog() const
+{
+    // The bounded query log is a ring buffer, return records in the executed order
+    rotateQueryLog();
+
+    return m_queryLog;
+}
+
 void LogsQueries::flushQueryLog()
 {
     // TODO sync silverqx
@@ -97,18 +107,47 @@ void LogsQueries::flushQueryLog()
         m_queryLog->clear();
 
     m_queryLogId = 0;
+    m_queryLogHead = 0;
 }
 
-void LogsQueries::enableQueryLog()
+void LogsQueries::enableQueryLog(const std::size_t maxSize)
 {
     /* Instantiate the query log vector lazily, right before it is really needed,
        and do not flush it. */
     if (!m_queryLog)
         m_queryLog = std::make_shared<QVector<Log>>();
 
+    rotateQueryLog();
+
+    m_queryLogMaxSize = maxSize;
+
+    // Keep only the most recent records if the query log was bigger
+    if (const auto size = static_cast<std::size_t>(m_queryLog->size());
+        maxSize > 0 && size > maxSize
+    )
+        m_queryLog->remove(0, static_cast<QVector<Log>::size_type>(size - maxSize));
+
     m_loggingQueries = true;
 }
 
+void LogsQueries::enableQueryAnalyzer(Support::QueryAnalyzer::CallbackType callback,
+                                      const qint64 slowQueryThreshold,
+                                      const qint64 nPlusOneThreshold)
+{
+    m_queryAnalyzer.emplace(std::move(callback), slowQueryThreshold, nPlusOneThreshold);
+}
+
+void LogsQueries::disableQueryAnalyzer()
+{
+    m_queryAnalyzer.reset();
+}
+
+void LogsQueries::resetQueryAnalyzer()
+{
+    if (m_queryAnalyzer)
+        m_queryAnalyzer->reset();
+}
+
 /* protected */
 
 QVector<Log>
@@ -120,6 +159,9 @@ LogsQueries::withFreshQueryLog(const std::function<QVector<Log>()> &callback)
     const auto loggingQueries = m_loggingQueries;
     const auto queryLogId = m_queryLogId.load();
     m_queryLogId.store(0);
+    // The query log for pretending is always unbounded
+    const auto queryLogMaxSize = std::exchange(m_queryLogMaxSize, 0);
+    const auto queryLogHead = std::exchange(m_queryLogHead, 0);
 
     enableQueryLog();
 
@@ -141,11 +183,22 @@ LogsQueries::withFreshQueryLog(const std::function<QVector<Log>()> &callback)
     m_queryLog.swap(m_queryLogForPretend);
     m_loggingQueries = loggingQueries;
     m_queryLogId.store(queryLogId);
+    m_queryLogMaxSize = queryLogMaxSize;
+    m_queryLogHead = queryLogHead;
 
     // NRVO kicks in
     return result;
 }
 
+void LogsQueries::analyzeQuery(const QString &queryString,
+                               const QVector<QVariant> &bindings,
+                               const StatementType type, const qint64 nsecs)
+{
+    if (m_queryAnalyzer)
+        m_queryAnalyzer->analyze(databaseConnection().getName(), queryString, bindings,
+                                 type, nsecs);
+}
+
 /* private */
 
 void LogsQueries::logQueryInternal(
@@ -161,15 +214,15 @@ void LogsQueries::logQueryInternal(
         if (executedQuery.isEmpty())
             executedQuery = query.lastQuery();
 
-        m_queryLog->append({std::move(executedQuery),
+        appendToQueryLog({std::move(executedQuery),
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-                            query.boundValues(),
+                          query.boundValues(),
 #else
-                            convertNamedToPositionalBindings(query.boundValues()),
+                          convertNamedToPositionalBindings(query.boundValues()),
 #endif
-                            Log::Type::NORMAL, ++m_queryLogId,
-                            elapsed ? *elapsed : -1, query.size(),
-                            query.numRowsAffected()});
+                          Log::Type::NORMAL, ++m_queryLogId,
+                          elapsed ? *elapsed : -1, query.size(),
+                          query.numRowsAffected()});
     }
 
 #ifdef TINYORM_DEBUG_SQL
@@ -191,6 +244,33 @@ void LogsQueries::logQueryInternal(
 #endif
 }
 
+void LogsQueries::appendToQueryLog(Log &&log) const
+{
+    const auto size = static_cast<std::size_t>(m_queryLog->size());
+
+    if (m_queryLogMaxSize == 0 || size < m_queryLogMaxSize) {
+        m_queryLog->append(std::move(log));
+        return;
+    }
+
+    // The bounded query log is full, overwrite the oldest record
+    (*m_queryLog)[static_cast<QVector<Log>::size_type>(m_queryLogHead)] = std::move(log);
+
+    m_queryLogHead = (m_queryLogHead + 1) % m_queryLogMaxSize;
+}
+
+void LogsQueries::rotateQueryLog() const
+{
+    if (m_queryLogHead == 0 || !m_queryLog)
+        return;
+
+    const auto head = static_cast<QVector<Log>::size_type>(m_queryLogHead);
+
+    std::rotate(m_queryLog->begin(), m_queryLog->begin() + head, m_queryLog->end());
+
+    m_queryLogHead = 0;
+}
+
 QVector<QVariant>
 LogsQueries::convertNamedToPositionalBindings(QVariantMap &&bindings) // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
 {
@@ -29,7 +29,7 @@ bool ManagesTransactions::beginTransaction()
     const auto countElapsed = databaseConnection().shouldCountElapsed();
 
     QElapsedTimer timer;
-    if (countElapsed)
+    if (countElapsed || databaseConnection().shouldCountLatencies())
         timer.start();
 
     if (!databaseConnection().pretending() &&
@@ -46,7 +46,8 @@ bool ManagesTransactions::beginTransaction()
     m_inTransaction = true;
 
     // Queries execution time counter / Query statements counter
-    const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
+    const auto elapsed = countsQueries().hitTransactionalCounters(queryString, timer,
+                                                                  countElapsed);
 
     /* Once we have run the transaction query we will calculate the time
        that it took to run and then log the query and execution time.
@@ -69,7 +70,7 @@ bool ManagesTransactions::commit()
     const auto countElapsed = databaseConnection().shouldCountElapsed();
 
     QElapsedTimer timer;
-    if (countElapsed)
+    if (countElapsed || databaseConnection().shouldCountLatencies())
         timer.start();
 
     if (!databaseConnection().pretending() &&
@@ -85,7 +86,8 @@ bool ManagesTransactions::commit()
     resetTransactions();
 
     // Queries execution time counter / Query statements counter
-    const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
+    const auto elapsed = countsQueries().hitTransactionalCounters(queryString, timer,
+                                                                  countElapsed);
 
     /* Once we have run the transaction query we will calculate the time
        that it took to run and then log the query and execution time.
@@ -108,7 +110,7 @@ bool ManagesTransactions::rollBack()
     const auto countElapsed = databaseConnection().shouldCountElapsed();
 
     QElapsedTimer timer;
-    if (countElapsed)
+    if (countElapsed || databaseConnection().shouldCountLatencies())
         timer.start();
 
     if (!databaseConnection().pretending() &&
@@ -124,7 +126,8 @@ bool ManagesTransactions::rollBack()
     resetTransactions();
 
     // Queries execution time counter / Query statements counter
-    const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
+    const auto elapsed = countsQueries().hitTransactionalCounters(queryString, timer,
+                                                                  countElapsed);
 
     /* Once we have run the transaction query we will calculate the time
        that it took to run and then log the query and execution time.
@@ -149,7 +152,7 @@ bool ManagesTransactions::savepoint(const QString &id)
     const auto countElapsed = databaseConnection().shouldCountElapsed();
 
     QElapsedTimer timer;
-    if (countElapsed)
+    if (countElapsed || databaseConnection().shouldCountLatencies())
         timer.start();
 
     // Execute a savepoint query
@@ -164,7 +167,8 @@ bool ManagesTransactions::savepoint(const QString &id)
     ++m_savepoints;
 
     // Queries execution time counter / Query statements counter
-    const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
+    const auto elapsed = countsQueries().hitTransactionalCounters(queryString, timer,
+                                                                  countElapsed);
 
     /* Once we have run the transaction query we will calculate the time
        that it took to run and then log the query and execution time.
@@ -195,7 +199,7 @@ bool ManagesTransactions::rollbackToSavepoint(const QString &id)
     const auto countElapsed = databaseConnection().shouldCountElapsed();
 
     QElapsedTimer timer;
-    if (countElapsed)
+    if (countElapsed || databaseConnection().shouldCountLatencies())
         timer.start();
 
     // Execute a rollback to savepoint query
@@ -210,7 +214,8 @@ bool ManagesTransactions::rollbackToSavepoint(const QString &id)
     m_savepoints = std::max<decltype (m_savepoints)>(0, m_savepoints - 1);
 
     // Queries execution time counter / Query statements counter
-    const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
+    const auto elapsed = countsQueries().hitTransactionalCounters(queryString, timer,
+                                                                  countElapsed);
 
     /* Once we have run the transaction query we will calculate the time
        that it took to run and then log the query and execution time.
@@ -1,10 +1,21 @@
 #include "orm/configurations/sqliteconfigurationparser.hpp"
 
+#include <unordered_map>
+
 #include "orm/constants.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Constants::NAME;
+using Orm::Constants::busy_timeout;
+using Orm::Constants::cache_size;
+using Orm::Constants::journal_mode;
+using Orm::Constants::mmap_size;
+using Orm::Constants::page_size;
 using Orm::Constants::return_qdatetime;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
 
 namespace Orm::Configurations
 {
@@ -15,12 +26,87 @@ void SQLiteConfigurationParser::parseDriverSpecificOptions() const
 {
     if (!config().contains(return_qdatetime))
         config().insert(return_qdatetime, true);
+
+    /* Validate and normalize the PRAGMA options, their values are used directly
+       in the PRAGMA statements, so they can't be bound. */
+    parseNamedPragmas();
+    parseIntegerPragmas();
 }
 
 void SQLiteConfigurationParser::parseDriverSpecificOptionsOption(
         QVariantHash &/*unused*/) const
 {}
 
+/* private */
+
+void SQLiteConfigurationParser::parseNamedPragmas() const
+{
+    static const std::unordered_map<QString, QStringList> allowedValues {
+        {journal_mode, {QStringLiteral("DELETE"), QStringLiteral("TRUNCATE"),
+                        QStringLiteral("PERSIST"), QStringLiteral("MEMORY"),
+                        QStringLiteral("WAL"), QStringLiteral("OFF")}},
+        {synchronous,  {QStringLiteral("OFF"), QStringLiteral("NORMAL"),
+                        QStringLiteral("FULL"), QStringLiteral("EXTRA")}},
+        {temp_store,   {QStringLiteral("DEFAULT"), QStringLiteral("FILE"),
+                        QStringLiteral("MEMORY")}},
+    };
+
+    for (const auto &[option, values] : allowedValues) {
+        // Nothing to validate
+        if (!config().contains(option))
+            continue;
+
+        auto value = config()[option].value<QString>().toUpper();
+
+        if (!values.contains(value))
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral(
+                        "The SQLite '%1' configuration option must be one of the '%2' "
+                        "values in the '%3' connection configuration, in %4().")
+                    .arg(option, values.join(QStringLiteral("', '")),
+                         config()[NAME].value<QString>(), __tiny_func__));
+
+        config().insert(option, std::move(value));
+    }
+}
+
+void SQLiteConfigurationParser::parseIntegerPragmas() const
+{
+    for (const auto &option : {cache_size, mmap_size, busy_timeout, page_size}) {
+        // Nothing to validate
+        if (!config().contains(option))
+            continue;
+
+        auto ok = false;
+        const auto value = config()[option].toLongLong(&ok);
+
+        // The cache_size can be negative (the number of KiB instead of pages)
+        if (ok && (option == cache_size || value >= 0) &&
+            (option != page_size || isValidPageSize(value))
+        ) {
+            config().insert(option, value);
+            continue;
+        }
+
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral(
+                    "The SQLite '%1' configuration option must be %2 in the '%3' "
+                    "connection configuration, in %4().")
+                .arg(option,
+                     option == cache_size
+                     ? QStringLiteral("an integer")
+                     : option == page_size
+                       ? QStringLiteral("a power of two between 512 and 65536")
+                       : QStringLiteral("a non-negative integer"),
+                     config()[NAME].value<QString>(), __tiny_func__));
+    }
+}
+
+bool SQLiteConfigurationParser::isValidPageSize(const qint64 pageSize) noexcept
+{
+    return pageSize >= 512 && pageSize <= 65536 && (pageSize & (pageSize - 1)) == 0;
+}
+
 } // namespace Orm::Configurations
 
 TINYORM_END_COMMON_NAMESPACE
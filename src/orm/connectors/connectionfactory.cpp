@@ -8,6 +8,7 @@
 #include "orm/mysqlconnection.hpp"
 #include "orm/postgresconnection.hpp"
 #include "orm/sqliteconnection.hpp"
+#include "orm/support/connectionpool.hpp"
 #include "orm/utils/configuration.hpp"
 #include "orm/utils/type.hpp"
 
@@ -26,6 +27,9 @@ ConnectionFactory::make(QVariantHash &config, const ConnectionName &connection)
     // Parse and prepare the database configuration
     auto configCopy = parseConfiguration(config, connection);
 
+    if (configCopy.contains(read_))
+        return createReadWriteConnection(std::move(configCopy));
+
     return createSingleConnection(std::move(configCopy));
 }
 
@@ -78,13 +82,114 @@ ConnectionFactory::createSingleConnection(QVariantHash &&config)
                                                       .value<bool>())
                                  : std::nullopt;
 
+    /* The pooled connection doesn't open a physical connection by itself, physical
+       connections are leased from the connection pool (see DB::lease()). */
+    auto resolver = config.contains(pool_)
+                    ? Support::ConnectionPool::unleasedResolver(
+                          config[NAME].value<QString>())
+                    : createQSqlDatabaseResolver(config);
+
     return createConnection(
-                config[driver_].value<QString>(), createQSqlDatabaseResolver(config),
+                config[driver_].value<QString>(), std::move(resolver),
                 config[database_].value<QString>(), config[prefix_].value<QString>(),
                 config[qt_timezone].value<QtTimeZoneConfig>(),
                 std::move(config), returnQDateTime);
 }
 
+std::shared_ptr<DatabaseConnection>
+ConnectionFactory::createReadWriteConnection(QVariantHash &&config)
+{
+    auto readConnections = createReadConnections(config);
+
+    auto connection = createSingleConnection(getWriteConfig(config));
+
+    connection->setReadConnections(std::move(readConnections));
+
+    return connection;
+}
+
+Support::ReadConnections
+ConnectionFactory::createReadConnections(const QVariantHash &config)
+{
+    const auto readConfig = getReadConfig(config);
+    const auto connection = readConfig[NAME].value<QString>();
+    const auto strategy = parseReadStrategy(readConfig);
+
+    std::vector<std::function<ConnectionName()>> resolvers;
+    QStringList qtConnectionNames;
+
+    /* Every read host is a separate read replica with its own QSqlDatabase connection,
+       the SQLite read connection doesn't have any host. */
+    const auto hosts = readConfig.contains(host_) ? parseHosts(readConfig)
+                                                  : QStringList {EMPTY};
+    resolvers.reserve(static_cast<std::size_t>(hosts.size()));
+    qtConnectionNames.reserve(hosts.size());
+
+    for (QStringList::size_type index = 0; index < hosts.size(); ++index) {
+        auto replicaConfig = readConfig;
+
+        if (!hosts.at(index).isEmpty())
+            replicaConfig[host_] = hosts.at(index);
+
+        auto qtConnectionName = QStringLiteral("%1-read-%2").arg(connection)
+                                                            .arg(index + 1);
+        replicaConfig[NAME] = qtConnectionName;
+        qtConnectionNames << std::move(qtConnectionName);
+
+        // The host is already picked, don't try to connect to other hosts
+        resolvers.emplace_back(
+                    createQSqlDatabaseResolverWithoutHosts(replicaConfig));
+    }
+
+    return {std::move(resolvers), std::move(qtConnectionNames), strategy};
+}
+
+QVariantHash ConnectionFactory::getReadConfig(const QVariantHash &config)
+{
+    return mergeReadWriteConfig(config, config[read_].value<QVariantHash>());
+}
+
+QVariantHash ConnectionFactory::getWriteConfig(const QVariantHash &config)
+{
+    return mergeReadWriteConfig(config, config.value(write_).value<QVariantHash>());
+}
+
+QVariantHash
+ConnectionFactory::mergeReadWriteConfig(const QVariantHash &config,
+                                        const QVariantHash &merge)
+{
+    auto merged = config;
+
+    for (auto itMerge = merge.constBegin(); itMerge != merge.constEnd(); ++itMerge)
+        merged.insert(itMerge.key(), itMerge.value());
+
+    merged.remove(read_);
+    merged.remove(write_);
+
+    return merged;
+}
+
+Support::ReadConnections::Strategy
+ConnectionFactory::parseReadStrategy(const QVariantHash &config)
+{
+    using Strategy = Support::ReadConnections::Strategy;
+
+    const auto strategy = config.value(read_strategy).value<QString>();
+
+    if (strategy.isEmpty() || strategy == QStringLiteral("round_robin"))
+        return Strategy::RoundRobin;
+
+    if (strategy == QStringLiteral("least_latency"))
+        return Strategy::LeastLatency;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral(
+                    "The '%1' value for the 'read_strategy' configuration option is not "
+                    "valid, allowed values are 'round_robin' and 'least_latency' "
+                    "in %2().")
+                .arg(strategy, __tiny_func__));
+}
+
 std::function<ConnectionName()>
 ConnectionFactory::createQSqlDatabaseResolver(const QVariantHash &config)
 {
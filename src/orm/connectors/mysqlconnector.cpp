@@ -38,19 +38,10 @@ MySqlConnector::connect(const QVariantHash &config) const
     // Create and open new database connection
     const auto connection = createConnection(name, config, options);
 
-    // Session transaction isolation
-    configureIsolationLevel(connection, config);
-
-    // Connection encoding and collation
-    configureEncoding(connection, config);
-
-    /* Next, we will check to see if a timezone has been specified in this config
-       and if it has we will issue a statement to modify the timezone with the
-       database. Setting this DB timezone is an optional configuration item. */
-    configureTimezone(connection, config);
-
-    // Set database modes, affected by 'strict' or 'modes' configuration options
-    setModes(connection, config);
+    /* Session transaction isolation, connection encoding and collation, timezone,
+       and database modes affected by the 'strict' or 'modes' configuration options
+       are set using one set statement (one round trip). */
+    configureSession(connection, config);
 
     /* Return only connection name, because QSqlDatabase documentation doesn't
        recommend to store QSqlDatabase instance as a class data member, we can
@@ -66,36 +57,76 @@ MySqlConnector::getConnectorOptions() const
 
 /* protected */
 
-void MySqlConnector::configureIsolationLevel(const QSqlDatabase &connection,
-                                             const QVariantHash &config)
+void MySqlConnector::configureSession(const QSqlDatabase &connection,
+                                      const QVariantHash &config)
 {
-    if (!config.contains(isolation_level))
+    QStringList assignments;
+    assignments.reserve(4);
+
+    for (auto &&assignment : {isolationLevelAssignment(connection, config),
+                              encodingAssignment(config),
+                              timezoneAssignment(config),
+                              modesAssignment(connection, config)}
+    )
+        if (assignment)
+            assignments << *assignment;
+
+    if (assignments.isEmpty())
         return;
 
     QSqlQuery query(connection);
 
-    if (query.exec(QStringLiteral("SET SESSION TRANSACTION ISOLATION LEVEL %1;")
-                   .arg(config[isolation_level].value<QString>())))
+    /* The MySQL set statement allows to assign more variables at once, the QMYSQL
+       driver doesn't enable multi-statements by default so they can't be separated
+       by the semicolon like in the PostgreSQL. */
+    if (query.exec(QStringLiteral("set %1;").arg(assignments.join(COMMA))))
         return;
 
     throw Exceptions::QueryError(connection.connectionName(),
                                  m_configureErrorMessage.arg(__tiny_func__), query);
 }
 
-void MySqlConnector::configureEncoding(const QSqlDatabase &connection,
-                                       const QVariantHash &config)
+std::optional<QString>
+MySqlConnector::isolationLevelAssignment(const QSqlDatabase &connection,
+                                         const QVariantHash &config)
 {
-    if (!config.contains(charset_))
-        return;
+    if (!config.contains(isolation_level))
+        return std::nullopt;
 
-    QSqlQuery query(connection);
+    /* The same as the SET SESSION TRANSACTION ISOLATION LEVEL statement, but
+       the system variable value uses the dash instead of the space, eg.
+       REPEATABLE-READ. */
+    auto level = config[isolation_level].value<QString>().simplified();
+    level.replace(QLatin1Char(' '), QLatin1Char('-'));
 
-    if (query.exec(QStringLiteral("set names '%1'%2;")
-                   .arg(config[charset_].value<QString>(), getCollation(config))))
-        return;
+    return QStringLiteral("session %1='%2'")
+            .arg(isolationLevelVariable(connection, config), level);
+}
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+QString MySqlConnector::isolationLevelVariable(const QSqlDatabase &connection,
+                                               const QVariantHash &config)
+{
+    const auto version = getMySqlVersion(connection, config);
+    const auto versionNumber = QVersionNumber::fromString(version);
+
+    /* The transaction_isolation was added in MySQL 5.7.20 (the tx_isolation was
+       removed in 8.0.3) and in MariaDB 11.1.1. */
+    const auto hasTransactionIsolation =
+            version.contains(QStringLiteral("MariaDB"))
+            ? versionNumber >= QVersionNumber(11, 1, 1)
+            : versionNumber >= QVersionNumber(5, 7, 20);
+
+    return hasTransactionIsolation ? QStringLiteral("transaction_isolation")
+                                   : QStringLiteral("tx_isolation");
+}
+
+std::optional<QString> MySqlConnector::encodingAssignment(const QVariantHash &config)
+{
+    if (!config.contains(charset_))
+        return std::nullopt;
+
+    return QStringLiteral("names '%1'%2")
+            .arg(config[charset_].value<QString>(), getCollation(config));
 }
 
 QString MySqlConnector::getCollation(const QVariantHash &config)
@@ -105,50 +136,36 @@ QString MySqlConnector::getCollation(const QVariantHash &config)
             : QString("");
 }
 
-void MySqlConnector::configureTimezone(const QSqlDatabase &connection,
-                                       const QVariantHash &config)
+std::optional<QString> MySqlConnector::timezoneAssignment(const QVariantHash &config)
 {
+    /* Check to see if a timezone has been specified in this config and if it has
+       we will issue a statement to modify the timezone with the database. Setting
+       this DB timezone is an optional configuration item. */
     if (!config.contains(timezone_))
-        return;
+        return std::nullopt;
 
-    QSqlQuery query(connection);
-
-    if (query.exec(QStringLiteral("set time_zone=\"%1\";")
-                   .arg(config[timezone_].value<QString>())))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("time_zone=\"%1\"").arg(config[timezone_].value<QString>());
 }
 
-void MySqlConnector::setModes(const QSqlDatabase &connection,
-                              const QVariantHash &config)
+std::optional<QString>
+MySqlConnector::modesAssignment(const QSqlDatabase &connection,
+                                const QVariantHash &config)
 {
     // Custom modes defined
     if (config.contains("modes"))
-        return setCustomModes(connection, config); // clazy:exclude=returning-void-expression
+        return QStringLiteral("session sql_mode='%1'").arg(customModes(config));
 
     // No strict defined
     if (!config.contains(strict_))
-        return;
-
-    QSqlQuery query(connection);
+        return std::nullopt;
 
     // Enable strict mode
-    if (config[strict_].value<bool>()) {
-        if (query.exec(strictMode(connection, config)))
-            return;
-
-        throw Exceptions::QueryError(connection.connectionName(),
-                                     m_configureErrorMessage.arg(__tiny_func__), query);
-    }
+    if (config[strict_].value<bool>())
+        return QStringLiteral("session sql_mode='%1'")
+                .arg(strictMode(connection, config));
 
     // Set defaults, no strict mode
-    if (query.exec(QStringLiteral("set session sql_mode='NO_ENGINE_SUBSTITUTION'")))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("session sql_mode='NO_ENGINE_SUBSTITUTION'");
 }
 
 QString MySqlConnector::strictMode(const QSqlDatabase &connection,
@@ -158,14 +175,13 @@ QString MySqlConnector::strictMode(const QSqlDatabase &connection,
 
     /* NO_AUTO_CREATE_USER was removed in 8.0.11 */
     if (QVersionNumber::fromString(version) >= QVersionNumber(8, 0, 11))
-        return QStringLiteral("set session sql_mode='ONLY_FULL_GROUP_BY,"
-                              "STRICT_TRANS_TABLES,NO_ZERO_IN_DATE,NO_ZERO_DATE,"
-                              "ERROR_FOR_DIVISION_BY_ZERO,NO_ENGINE_SUBSTITUTION'");
-
-    return QStringLiteral("set session sql_mode='ONLY_FULL_GROUP_BY,"
-                          "STRICT_TRANS_TABLES,NO_ZERO_IN_DATE,NO_ZERO_DATE,"
-                          "ERROR_FOR_DIVISION_BY_ZERO,NO_AUTO_CREATE_USER,"
-                          "NO_ENGINE_SUBSTITUTION'");
+        return QStringLiteral("ONLY_FULL_GROUP_BY,STRICT_TRANS_TABLES,NO_ZERO_IN_DATE,"
+                              "NO_ZERO_DATE,ERROR_FOR_DIVISION_BY_ZERO,"
+                              "NO_ENGINE_SUBSTITUTION");
+
+    return QStringLiteral("ONLY_FULL_GROUP_BY,STRICT_TRANS_TABLES,NO_ZERO_IN_DATE,"
+                          "NO_ZERO_DATE,ERROR_FOR_DIVISION_BY_ZERO,NO_AUTO_CREATE_USER,"
+                          "NO_ENGINE_SUBSTITUTION");
 }
 
 QString MySqlConnector::getMySqlVersion(const QSqlDatabase &connection,
@@ -187,18 +203,9 @@ QString MySqlConnector::getMySqlVersion(const QSqlDatabase &connection,
     return MySqlVersionCache = getMySqlVersionFromDatabase(connection);
 }
 
-void MySqlConnector::setCustomModes(const QSqlDatabase &connection,
-                                    const QVariantHash &config)
+QString MySqlConnector::customModes(const QVariantHash &config)
 {
-    const auto modes = config["modes"].value<QStringList>().join(COMMA);
-
-    QSqlQuery query(connection);
-
-    if (query.exec(QStringLiteral("set session sql_mode='%1';").arg(modes)))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return config["modes"].value<QStringList>().join(COMMA);
 }
 
 /* private */
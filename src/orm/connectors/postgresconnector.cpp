@@ -11,6 +11,7 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 using Orm::Constants::DEFAULT;
 using Orm::Constants::LOCAL;
 using Orm::Constants::NAME;
+using Orm::Constants::SPACE;
 using Orm::Constants::TMPL_DQUOTES;
 using Orm::Constants::charset_;
 using Orm::Constants::isolation_level;
@@ -38,25 +39,10 @@ PostgresConnector::connect(const QVariantHash &config) const
     // Create and open new database connection
     const auto connection = createConnection(name, config, options);
 
-    // Transaction isolation level
-    configureIsolationLevel(connection, config);
-
-    // Connection encoding
-    configureEncoding(connection, config);
-
-    /* Next, we will check to see if a timezone has been specified in this config
-       and if it has we will issue a statement to modify the timezone with the
-       database. Setting this DB timezone is an optional configuration item. */
-    configureTimezone(connection, config);
-
-    configureSearchPath(connection, config);
-
-    /* Postgres allows an application_name to be set by the user and this name is
-       used to when monitoring the application with pg_stat_activity. So we'll
-       determine if the option has been specified and run a statement if so. */
-    configureApplicationName(connection, config);
-
-    configureSynchronousCommit(connection, config);
+    /* Configure the session (transaction isolation level, encoding, timezone,
+       search_path, application_name, and synchronous_commit), all statements
+       are sent to the database server at once (one round trip). */
+    configureSession(connection, config);
 
     /* Return only connection name, because QSqlDatabase documentation doesn't
        recommend to store QSqlDatabase instance as a class data member, we can
@@ -72,37 +58,55 @@ PostgresConnector::getConnectorOptions() const
 
 /* protected */
 
-void PostgresConnector::configureIsolationLevel(const QSqlDatabase &connection,
-                                                const QVariantHash &config)
+void PostgresConnector::configureSession(const QSqlDatabase &connection,
+                                         const QVariantHash &config)
 {
-    if (!config.contains(isolation_level))
+    QStringList statements;
+    statements.reserve(6);
+
+    for (auto &&statement : {isolationLevelStatement(config),
+                             encodingStatement(config),
+                             timezoneStatement(config),
+                             searchPathStatement(config),
+                             applicationNameStatement(config),
+                             synchronousCommitStatement(config)}
+    )
+        if (statement)
+            statements << *statement;
+
+    if (statements.isEmpty())
         return;
 
     QSqlQuery query(connection);
 
-    if (query.exec(QStringLiteral("set session characteristics as "
-                                  "transaction isolation level %1;")
-                   .arg(config[isolation_level].value<QString>())))
+    /* The simple query protocol allows more statements separated by the semicolon
+       in one query, so every configuration option doesn't cost another round trip
+       to the database server (they matter a lot during the connection storm). */
+    if (query.exec(statements.join(SPACE)))
         return;
 
     throw Exceptions::QueryError(connection.connectionName(),
                                  m_configureErrorMessage.arg(__tiny_func__), query);
 }
 
-void PostgresConnector::configureEncoding(const QSqlDatabase &connection,
-                                          const QVariantHash &config)
+std::optional<QString>
+PostgresConnector::isolationLevelStatement(const QVariantHash &config)
 {
-    if (!config.contains(charset_))
-        return;
+    if (!config.contains(isolation_level))
+        return std::nullopt;
 
-    QSqlQuery query(connection);
+    return QStringLiteral("set session characteristics as "
+                          "transaction isolation level %1;")
+            .arg(config[isolation_level].value<QString>());
+}
 
-    if (query.exec(QStringLiteral("set names '%1';")
-                   .arg(config[charset_].value<QString>())))
-        return;
+std::optional<QString>
+PostgresConnector::encodingStatement(const QVariantHash &config)
+{
+    if (!config.contains(charset_))
+        return std::nullopt;
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("set names '%1';").arg(config[charset_].value<QString>());
 }
 
 /*! The key comparison function for the Compare template parameter. */
@@ -115,47 +119,35 @@ struct QStringLessCi
     }
 };
 
-void PostgresConnector::configureTimezone(const QSqlDatabase &connection,
-                                          const QVariantHash &config)
+std::optional<QString>
+PostgresConnector::timezoneStatement(const QVariantHash &config)
 {
+    /* Check to see if a timezone has been specified in this config and if it has
+       we will issue a statement to modify the timezone with the database. Setting
+       this DB timezone is an optional configuration item. */
     if (!config.contains(timezone_))
-        return;
-
-    QSqlQuery query(connection);
+        return std::nullopt;
 
     static const std::set<QString, QStringLessCi> local {DEFAULT, LOCAL};
 
     const auto timezone = config[timezone_].value<QString>();
 
-    if (local.contains(timezone)) {
-        if (query.exec(QStringLiteral("set time zone %1;").arg(timezone)))
-            return;
-    } else
-        if (query.exec(QStringLiteral("set time zone '%1';").arg(timezone)))
-            return;
+    if (local.contains(timezone))
+        return QStringLiteral("set time zone %1;").arg(timezone);
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("set time zone '%1';").arg(timezone);
 }
 
-void PostgresConnector::configureSearchPath(const QSqlDatabase &connection,
-                                            const QVariantHash &config)
+std::optional<QString>
+PostgresConnector::searchPathStatement(const QVariantHash &config)
 {
     if (!config.contains(search_path))
-        return;
-
-    QSqlQuery query(connection);
+        return std::nullopt;
 
     // Don't add the searchPath.isEmpty() check here to allow set "" (empty search path)
 
-    if (query.exec(QStringLiteral("set search_path to %1;")
-                   .arg(quoteSearchPath(
-                            parseSearchPath(config[search_path]))))
-    )
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("set search_path to %1;")
+            .arg(quoteSearchPath(parseSearchPath(config[search_path])));
 }
 
 QString PostgresConnector::quoteSearchPath(const QStringList &searchPath)
@@ -168,36 +160,27 @@ QString PostgresConnector::quoteSearchPath(const QStringList &searchPath)
     return TMPL_DQUOTES.arg(ContainerUtils::join(searchPath, QStringLiteral("\", \"")));
 }
 
-void PostgresConnector::configureApplicationName(const QSqlDatabase &connection,
-                                                 const QVariantHash &config)
+std::optional<QString>
+PostgresConnector::applicationNameStatement(const QVariantHash &config)
 {
+    /* Postgres allows an application_name to be set by the user and this name is
+       used to when monitoring the application with pg_stat_activity. So we'll
+       determine if the option has been specified and run a statement if so. */
     if (!config.contains("application_name"))
-        return;
+        return std::nullopt;
 
-    QSqlQuery query(connection);
-
-    if (query.exec(QStringLiteral("set application_name to '%1';")
-                   .arg(config["application_name"].value<QString>())))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("set application_name to '%1';")
+            .arg(config["application_name"].value<QString>());
 }
 
-void PostgresConnector::configureSynchronousCommit(const QSqlDatabase &connection,
-                                                   const QVariantHash &config)
+std::optional<QString>
+PostgresConnector::synchronousCommitStatement(const QVariantHash &config)
 {
     if (!config.contains(synchronous_commit))
-        return;
+        return std::nullopt;
 
-    QSqlQuery query(connection);
-
-    if (query.exec(QStringLiteral("set synchronous_commit to '%1';")
-                   .arg(config[synchronous_commit].value<QString>())))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("set synchronous_commit to '%1';")
+            .arg(config[synchronous_commit].value<QString>());
 }
 
 } // namespace Orm::Connectors
@@ -3,6 +3,8 @@
 #include <QFile>
 #include <QtSql/QSqlQuery>
 
+#include <array>
+
 #include "orm/constants.hpp"
 #include "orm/exceptions/queryerror.hpp"
 #include "orm/exceptions/sqlitedatabasedoesnotexisterror.hpp"
@@ -11,9 +13,16 @@
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 using Orm::Constants::NAME;
+using Orm::Constants::busy_timeout;
+using Orm::Constants::cache_size;
 using Orm::Constants::check_database_exists;
 using Orm::Constants::database_;
 using Orm::Constants::foreign_key_constraints;
+using Orm::Constants::journal_mode;
+using Orm::Constants::mmap_size;
+using Orm::Constants::page_size;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
 
 using TypeUtils = Orm::Utils::Type;
 
@@ -50,6 +59,9 @@ SQLiteConnector::connect(const QVariantHash &config) const
     // Foreign key constraints
     configureForeignKeyConstraints(connection, config);
 
+    // Performance related PRAGMAs (journal_mode, synchronous, cache_size, ...)
+    configurePragmas(connection, config);
+
     /* Return only connection name, because QSqlDatabase documentation doesn't
        recommend to store QSqlDatabase instance as a class data member, we can
        simply obtain the connection by QSqlDatabase::connection() when needed. */
@@ -85,6 +97,36 @@ void SQLiteConnector::configureForeignKeyConstraints(const QSqlDatabase &connect
                                  m_configureErrorMessage.arg(__tiny_func__), query);
 }
 
+void SQLiteConnector::configurePragmas(const QSqlDatabase &connection,
+                                       const QVariantHash &config)
+{
+    /* The order matters, the page_size has to be set before the journal_mode=WAL
+       because the page size can't be changed in the WAL mode. Values are validated
+       and normalized by the SQLiteConfigurationParser. */
+    static const std::array pragmas {
+        page_size, journal_mode, synchronous, cache_size, mmap_size, temp_store,
+        busy_timeout,
+    };
+
+    /* The QSQLITE driver executes only the first statement from the query so every
+       PRAGMA has to be executed separately, they are local calls without any round
+       trip to the database server. */
+    for (const auto &pragma : pragmas) {
+        // This ensures default SQLite behavior
+        if (!config.contains(pragma))
+            continue;
+
+        QSqlQuery query(connection);
+
+        if (query.exec(QStringLiteral("PRAGMA %1 = %2;")
+                       .arg(pragma, config[pragma].value<QString>())))
+            continue;
+
+        throw Exceptions::QueryError(connection.connectionName(),
+                                     m_configureErrorMessage.arg(__tiny_func__), query);
+    }
+}
+
 /* private */
 
 void SQLiteConnector::checkDatabaseExists(const QVariantHash &config)
@@ -111,6 +111,22 @@ namespace Orm::Constants
     const QString application_name        = QStringLiteral("application_name");
     const QString synchronous_commit      = QStringLiteral("synchronous_commit");
     const QString spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    const QString prepared_statements_cache = QStringLiteral("prepared_statements_cache");
+    const QString where_in_array          = QStringLiteral("where_in_array");
+    const QString forward_only            = QStringLiteral("forward_only");
+    const QString journal_mode            = QStringLiteral("journal_mode");
+    const QString synchronous             = QStringLiteral("synchronous");
+    const QString cache_size              = QStringLiteral("cache_size");
+    const QString mmap_size               = QStringLiteral("mmap_size");
+    const QString temp_store              = QStringLiteral("temp_store");
+    const QString busy_timeout            = QStringLiteral("busy_timeout");
+    const QString page_size               = QStringLiteral("page_size");
+    const QString optimize_on_disconnect  = QStringLiteral("optimize_on_disconnect");
+    const QString pool_                   = QStringLiteral("pool");
+    const QString read_                   = QStringLiteral("read");
+    const QString write_                  = QStringLiteral("write");
+    const QString sticky_                 = QStringLiteral("sticky");
+    const QString read_strategy           = QStringLiteral("read_strategy");
 
     const QString H127001   = QStringLiteral("127.0.0.1");
     const QString LOCALHOST = QStringLiteral("localhost");
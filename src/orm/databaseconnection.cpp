@@ -54,7 +54,11 @@ DatabaseConnection::DatabaseConnection(
     , m_config(std::move(config))
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
-{}
+    , m_forwardOnly(getConfig(forward_only).value<bool>())
+    , m_sticky(getConfig(sticky_).value<bool>())
+{
+    initPreparedStatementsCache();
+}
 
 DatabaseConnection::DatabaseConnection(
         std::function<Connectors::ConnectionName()> &&connection,
@@ -70,7 +74,11 @@ DatabaseConnection::DatabaseConnection(
     , m_config(std::move(config))
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
-{}
+    , m_forwardOnly(getConfig(forward_only).value<bool>())
+    , m_sticky(getConfig(sticky_).value<bool>())
+{
+    initPreparedStatementsCache();
+}
 
 std::shared_ptr<QueryBuilder>
 DatabaseConnection::table(const QString &table, const QString &as)
@@ -110,23 +118,47 @@ std::shared_ptr<QueryBuilder> DatabaseConnection::query()
 /* Running SQL Queries */
 
 SqlQuery
-DatabaseConnection::select(const QString &queryString, QVector<QVariant> bindings)
+DatabaseConnection::select(const QString &queryString, QVector<QVariant> bindings,
+                           const std::optional<bool> forwardOnly,
+                           const bool useReadConnection)
 {
+    const auto forwardOnly_ = forwardOnly.value_or(m_forwardOnly);
+
     auto queryResult = run<QSqlQuery>(
                            queryString, std::move(bindings), Prepared,
-                           [this](const QString &queryString_,
-                                  const QVector<QVariant> &preparedBindings)
+                           StatementType::Select,
+                           [this, forwardOnly_, useReadConnection]
+                           (const QString &queryString_,
+                            const QVector<QVariant> &preparedBindings)
                            -> QSqlQuery
     {
         if (m_pretending)
             return getQtQueryForPretend();
 
+        /* Picked for every attempt so the retry after the lost connection can use
+           another read replica (the lost one is reconnected lazily). */
+        const auto readConnection = readConnectionIndex(useReadConnection);
+
         // Prepare QSqlQuery
-        auto query = prepareQuery(queryString_);
+        auto query = readConnection
+                     ? prepareReadQuery(queryString_, forwardOnly_, *readConnection)
+                     : prepareQuery(queryString_, forwardOnly_);
 
         bindValues(query, preparedBindings);
 
+        // Measure the read replica latency for the least-latency strategy
+        const auto measureLatency =
+                readConnection && m_readConnections.strategy() ==
+                                  Support::ReadConnections::Strategy::LeastLatency;
+
+        QElapsedTimer timer;
+        if (measureLatency)
+            timer.start();
+
         if (query.exec()) {
+            if (measureLatency)
+                m_readConnections.recordLatency(*readConnection, timer.nsecsElapsed());
+
             // Query statements counter
             if (m_countingStatements)
                 ++m_statementsCounter.normal;
@@ -134,6 +166,10 @@ DatabaseConnection::select(const QString &queryString, QVector<QVariant> binding
             return query;
         }
 
+        // Don't re-use the failed prepared statement
+        if (!readConnection)
+            forgetPreparedStatement(queryString_);
+
         /* If an error occurs when attempting to run a query, we'll transform it
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
@@ -160,18 +196,27 @@ DatabaseConnection::selectOne(const QString &queryString, QVector<QVariant> bind
 QVariant
 DatabaseConnection::scalar(const QString &queryString, QVector<QVariant> bindings)
 {
-    const auto query = selectOne(queryString, std::move(bindings));
+    auto query = selectOne(queryString, std::move(bindings));
 
     // Nothing to do, the query should be positioned on the first row/record
-    if (!query.isValid())
+    if (!query.isValid()) {
+        // Release the result so the cached prepared statement can be re-used
+        query.finish();
+
         return {};
+    }
 
     if (const auto count = query.record().count();
         count > 1
     )
         throw Exceptions::MultipleColumnsSelectedError(count, __tiny_func__);
 
-    return query.value(0);
+    auto value = query.value(0);
+
+    // Release the result so the cached prepared statement can be re-used
+    query.finish();
+
+    return value;
 }
 
 SqlQuery
@@ -179,6 +224,7 @@ DatabaseConnection::statement(const QString &queryString, QVector<QVariant> bind
 {
     auto queryResult = run<QSqlQuery>(
                            queryString, std::move(bindings), Prepared,
+                           StatementType::Affecting,
                            [this](const QString &queryString_,
                                   const QVector<QVariant> &preparedBindings)
                            -> QSqlQuery
@@ -201,6 +247,9 @@ DatabaseConnection::statement(const QString &queryString, QVector<QVariant> bind
             return query;
         }
 
+        // Don't re-use the failed prepared statement
+        forgetPreparedStatement(queryString_);
+
         // TODO perf, use __tiny_func__ but when I fix pref. problem with it, rewrite it w/o the QRegularExpression, look at and revert the 8e114524 and 03fc82ae commits, also use static local variable instead! ALSO create macro eg. T_FUNCTION_NAME - static const auto functionName = __tiny_func__; silverqx
         /* If an error occurs when attempting to run a query, we'll transform it
            to the exception QueryError(), which formats the error message to
@@ -220,7 +269,7 @@ DatabaseConnection::affectingStatement(const QString &queryString,
                                        QVector<QVariant> bindings)
 {
     return run<std::tuple<int, QSqlQuery>>(
-               queryString, std::move(bindings), Prepared,
+               queryString, std::move(bindings), Prepared, StatementType::Affecting,
                [this](const QString &queryString_,
                       const QVector<QVariant> &preparedBindings)
                -> std::tuple<int, QSqlQuery>
@@ -245,6 +294,9 @@ DatabaseConnection::affectingStatement(const QString &queryString,
             return {numRowsAffected, query};
         }
 
+        // Don't re-use the failed prepared statement
+        forgetPreparedStatement(queryString_);
+
         /* If an error occurs when attempting to run a query, we'll transform it
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
@@ -260,7 +312,7 @@ DatabaseConnection::affectingStatement(const QString &queryString,
 SqlQuery DatabaseConnection::unprepared(const QString &queryString)
 {
     auto queryResult = run<QSqlQuery>(
-                           queryString, {}, Unprepared,
+                           queryString, {}, Unprepared, StatementType::Affecting,
                            [this](const QString &queryString_,
                                   const QVector<QVariant> &/*unused*/)
                            -> QSqlQuery
@@ -294,6 +346,58 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
     return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
 }
 
+/* Prepared statements cache */
+
+DatabaseConnection &
+DatabaseConnection::enablePreparedStatementsCache(const std::size_t size)
+{
+    // Only resize the cache, already prepared statements are still valid
+    if (m_preparedStatementsCache)
+        m_preparedStatementsCacheCounter.evictions +=
+                static_cast<int>(m_preparedStatementsCache->setCapacity(size));
+
+    else {
+        m_preparedStatementsCache.emplace(size);
+
+        m_preparedStatementsCacheCounter.hits      = 0;
+        m_preparedStatementsCacheCounter.misses    = 0;
+        m_preparedStatementsCacheCounter.evictions = 0;
+    }
+
+    return *this;
+}
+
+DatabaseConnection &DatabaseConnection::disablePreparedStatementsCache()
+{
+    m_preparedStatementsCache.reset();
+
+    m_preparedStatementsCacheCounter.hits      = -1;
+    m_preparedStatementsCacheCounter.misses    = -1;
+    m_preparedStatementsCacheCounter.evictions = -1;
+
+    return *this;
+}
+
+DatabaseConnection &DatabaseConnection::flushPreparedStatementsCache()
+{
+    if (m_preparedStatementsCache)
+        m_preparedStatementsCache->clear();
+
+    return *this;
+}
+
+/* Read/write connections */
+
+DatabaseConnection &
+DatabaseConnection::setReadConnections(Support::ReadConnections &&connections)
+{
+    m_readConnections.disconnect();
+
+    m_readConnections = std::move(connections);
+
+    return *this;
+}
+
 /* Obtain connection instance */
 
 QSqlDatabase DatabaseConnection::getQtConnection()
@@ -302,9 +406,17 @@ QSqlDatabase DatabaseConnection::getQtConnection()
         // This should never happen 🤔
         Q_ASSERT(m_qtConnectionResolver);
 
+        /* Measure the connection establishment time, it includes opening
+           the physical connection and the session configuration. */
+        QElapsedTimer timer;
+        timer.start();
+
         // Reconnect if missing
         m_qtConnection = std::invoke(m_qtConnectionResolver);
 
+        m_connectElapsed = timer.elapsed();
+        ++m_connectsCount;
+
         /* This should never happen 🤔, do this check only when the QSqlDatabase
            connection was resolved by connection resolver. */
         if (!QSqlDatabase::contains(*m_qtConnection))
@@ -327,6 +439,16 @@ QSqlDatabase DatabaseConnection::getRawQtConnection() const
     return QSqlDatabase::database(*m_qtConnection);
 }
 
+QSqlDatabase DatabaseConnection::getReadQtConnection()
+{
+    if (const auto readConnection = readConnectionIndex(true); readConnection)
+        return m_readConnections.connection(*readConnection);
+
+    reconnectIfMissingConnection();
+
+    return getQtConnection();
+}
+
 DatabaseConnection &
 DatabaseConnection::setQtConnectionResolver(
         const std::function<Connectors::ConnectionName()> &resolver)
@@ -349,9 +471,46 @@ DatabaseConnection::setQtConnectionResolver(
     m_qtConnection.reset();
     m_qtConnectionResolver = resolver;
 
+    // Prepared statements are bound to the old QSqlDatabase connection
+    flushPreparedStatementsCache();
+
     return *this;
 }
 
+void DatabaseConnection::usePooledQtConnection(
+        const Connectors::ConnectionName &qtConnection,
+        std::function<Connectors::ConnectionName()> &&reopenResolver)
+{
+    /* The leased physical connection is already open, the resolver is only invoked
+       after the disconnect() or when the connection was lost, it reopens the same
+       physical connection through the connector so the session is configured again
+       (it has to stay bound to the same physical connection till the end
+       of the lease). */
+    m_unleasedQtConnectionResolver = std::exchange(m_qtConnectionResolver,
+                                                   std::move(reopenResolver));
+
+    m_qtConnection = qtConnection;
+    m_usingPooledQtConnection = true;
+}
+
+void DatabaseConnection::releasePooledQtConnection()
+{
+    // Nothing to release
+    if (!m_usingPooledQtConnection)
+        return;
+
+    // Prepared statements are bound to the leased QSqlDatabase connection
+    flushPreparedStatementsCache();
+
+    /* The transaction was already rolled back by the ConnectionLease, a transaction
+       can't outlive the lease. */
+    resetTransactions();
+
+    m_qtConnection.reset();
+    m_qtConnectionResolver = std::exchange(m_unleasedQtConnectionResolver, nullptr);
+    m_usingPooledQtConnection = false;
+}
+
 QSqlQuery DatabaseConnection::getQtQuery()
 {
     return QSqlQuery(getQtConnection());
@@ -360,7 +519,11 @@ QSqlQuery DatabaseConnection::getQtQuery()
 QVector<QVariant> &
 DatabaseConnection::prepareBindings(QVector<QVariant> &bindings) const
 {
-    for (auto &binding : bindings) {
+    /* The bindings are mostly shared with the query builder, access them using
+       the const reference so they are detached (copied) only if they are converted. */
+    for (QVector<QVariant>::size_type index = 0; index < bindings.size(); ++index) {
+        const auto &binding = std::as_const(bindings)[index];
+
         // Nothing to convert
         if (!binding.isValid() || binding.isNull())
             continue;
@@ -368,15 +531,15 @@ DatabaseConnection::prepareBindings(QVector<QVariant> &bindings) const
         switch (Helpers::qVariantTypeId(binding)) {
         // QDate doesn't have a time zone
         case QMetaType::QDate:
-            binding = binding.value<QDate>().toString(Qt::ISODate);
+            bindings[index] = binding.value<QDate>().toString(Qt::ISODate);
             break;
 
         /* We need to transform all instances of QDateTime into the actual date string.
            Each query grammar maintains its own date string format so we'll just ask
            the grammar for the format to get from the date. */
         case QMetaType::QDateTime:
-            binding = prepareBinding(binding.value<QDateTime>())
-                      .toString(m_queryGrammar->getDateFormat());
+            bindings[index] = prepareBinding(binding.value<QDateTime>())
+                              .toString(m_queryGrammar->getDateFormat());
             break;
 
         /* I have decided to not handle the QMetaType::Bool here, little info:
@@ -443,10 +606,19 @@ void DatabaseConnection::reconnect() const
 
 void DatabaseConnection::disconnect()
 {
+    // Read replicas are connected independently of the write connection
+    m_readConnections.disconnect();
+
     // Nothing to disconnect
     if (!m_qtConnection)
         return;
 
+    // Allow the driver-specific connection to do some work on the open connection
+    beforeDisconnect();
+
+    // Prepared statements have to be released before the connection is closed
+    flushPreparedStatementsCache();
+
     /* Closes the database connection, freeing any resources acquired,
        and invalidating any existing QSqlQuery objects that are used
        with the database.
@@ -457,7 +629,12 @@ void DatabaseConnection::disconnect()
     getRawQtConnection().close();
 
     m_qtConnection.reset();
-    m_qtConnectionResolver = nullptr;
+
+    /* The leased physical connection is only closed, it will be reopened during
+       the next query, the pooled connection can't be switched to another physical
+       connection during the lease. */
+    if (!m_usingPooledQtConnection)
+        m_qtConnectionResolver = nullptr;
 }
 
 SchemaBuilder &DatabaseConnection::getSchemaBuilder()
@@ -605,21 +782,94 @@ void DatabaseConnection::useDefaultPostProcessor()
     m_postProcessor = getDefaultPostProcessor();
 }
 
+void DatabaseConnection::beforeDisconnect()
+{}
+
 /* private */
 
-QSqlQuery DatabaseConnection::prepareQuery(const QString &queryString)
-{
+QSqlQuery
+DatabaseConnection::prepareQuery(const QString &queryString, const bool forwardOnly)
+{
+    /* Re-use the already prepared statement, the caller only re-binds values and
+       executes it. The select statement is re-used only if its previous result
+       was released or traversed to the end and it was prepared in the same
+       forward-only mode, otherwise a new statement is prepared and replaces
+       the cached one (the QSqlResult is shared). */
+    if (m_preparedStatementsCache) {
+        if (auto cachedQuery = m_preparedStatementsCache->get(queryString, forwardOnly);
+            cachedQuery
+        ) {
+            ++m_preparedStatementsCacheCounter.hits;
+
+            return std::move(*cachedQuery);
+        }
+
+        ++m_preparedStatementsCacheCounter.misses;
+    }
+
     // Prepare query string
     auto query = getQtQuery();
 
-    // TODO solve setForwardOnly() in DatabaseConnection class, again this problem 🤔 silverqx
-//    query.setForwardOnly(m_forwardOnly);
+    /* The forward-only query doesn't buffer the whole result on the client side, but
+       it can be traversed only once using next(), seek() backward, last() and size()
+       don't work (size() works only for some drivers). It must be set before prepare. */
+    query.setForwardOnly(forwardOnly);
+
+    // Cache only successfully prepared statements
+    if (query.prepare(queryString) && m_preparedStatementsCache &&
+        m_preparedStatementsCache->insert(queryString, query)
+    )
+        ++m_preparedStatementsCacheCounter.evictions;
+
+    return query;
+}
+
+QSqlQuery
+DatabaseConnection::prepareReadQuery(const QString &queryString, const bool forwardOnly,
+                                     const std::size_t readConnection)
+{
+    /* The prepared statements cache is bound to the write connection and every select
+       query can be executed on a different read replica, so it's not cached. */
+    QSqlQuery query(m_readConnections.connection(readConnection));
+
+    // It must be set before prepare
+    query.setForwardOnly(forwardOnly);
 
     query.prepare(queryString);
 
     return query;
 }
 
+std::optional<std::size_t>
+DatabaseConnection::readConnectionIndex(const bool useReadConnection)
+{
+    /* The write connection is used if there are no read replicas, inside
+       the transaction (it's active on the write connection only), and after
+       the write in the sticky mode so the modified records can be read back
+       immediately (replicas can lag behind). */
+    if (!useReadConnection || m_readConnections.isEmpty() || inTransaction() ||
+        (m_sticky && m_recordsModified)
+    )
+        return std::nullopt;
+
+    return m_readConnections.next();
+}
+
+void DatabaseConnection::forgetPreparedStatement(const QString &queryString)
+{
+    if (m_preparedStatementsCache)
+        m_preparedStatementsCache->remove(queryString);
+}
+
+void DatabaseConnection::initPreparedStatementsCache()
+{
+    // Disabled by default, the prepared_statements_cache value is the cache size
+    const auto size = getConfig(prepared_statements_cache).value<int>();
+
+    if (size > 0)
+        enablePreparedStatementsCache(static_cast<std::size_t>(size));
+}
+
 QDateTime DatabaseConnection::prepareBinding(const QDateTime &binding) const
 {
     /* Nothing to convert, the qt_timezone config. option is not valid or was not defined
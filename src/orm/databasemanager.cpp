@@ -5,6 +5,8 @@
 #include "orm/concerns/hasconnectionresolver.hpp"
 #include "orm/connectors/connectionfactory.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/support/connectionpool.hpp"
+#include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -345,8 +347,13 @@ bool DatabaseManager::removeConnection(const QString &name)
         return true;
     }
 
+    auto &connection = *m_connections->find(name_)->second;
+
     // Disconnect first to be nice 😁 and safe 😂
-    m_connections->find(name_)->second->disconnect();
+    connection.disconnect();
+
+    // Read replicas are registered in the QSqlDatabase under their own names
+    const auto readQtConnections = connection.getReadConnections().qtConnectionNames();
 
     /* If connection was not removed, return false and don't remove Qt's database
        connection and also don't remove connection configuration. */
@@ -358,6 +365,17 @@ bool DatabaseManager::removeConnection(const QString &name)
     // Remove Qt's database connection, ~QSqlDatabase() internally also calls close()
     QSqlDatabase::removeDatabase(name_);
 
+    for (const auto &readQtConnection : readQtConnections)
+        QSqlDatabase::removeDatabase(readQtConnection);
+
+    /* Idle physical connections are closed when the pool is destroyed, active leases
+       keep the pool alive till the end of the lease. */
+    {
+        const std::scoped_lock lock(m_poolsMutex);
+
+        m_pools.erase(name_);
+    }
+
     resetDefaultConnection_();
 
     return true;
@@ -377,6 +395,14 @@ DatabaseConnection &DatabaseManager::reconnect(const QString &name)
     if (!m_connections->contains(name_))
         return connection(name_);
 
+    /* The leased physical connection was only closed, it will be reopened and its
+       session configured during the next query (it can't be switched to another
+       physical connection). */
+    if (auto &connection = *(*m_connections)[name_];
+        connection.usingPooledQtConnection()
+    )
+        return connection;
+
     return refreshQtConnection(name_);
 }
 
@@ -395,6 +421,41 @@ void DatabaseManager::connectEagerly(const QString &name)
     connection(name).connectEagerly();
 }
 
+/* Connection pool */
+
+Support::ConnectionLease DatabaseManager::lease(const QString &connection)
+{
+    auto &connection_ = this->connection(connection);
+
+    return Support::ConnectionLease(connectionPool(connection_.getName()), connection_);
+}
+
+std::shared_ptr<Support::ConnectionPool>
+DatabaseManager::connectionPool(const QString &connection)
+{
+    /* The configurations and connections are thread-local, the pool is shared by all
+       threads so it's created from the configuration of the first thread. */
+    const auto &connection_ = this->connection(connection);
+    const auto &connectionName = connection_.getName();
+
+    if (!connection_.hasConfig(pool_))
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' connection is not pooled, set the 'pool' "
+                               "configuration option to use the connection pool "
+                               "in %2().")
+                .arg(connectionName, __tiny_func__));
+
+    const std::scoped_lock lock(m_poolsMutex);
+
+    auto &pool = m_pools[connectionName];
+
+    if (!pool)
+        pool = std::make_shared<Support::ConnectionPool>(connectionName,
+                                                         connection_.getConfig());
+
+    return pool;
+}
+
 QStringList DatabaseManager::connectionNames() const
 {
     return *m_configuration | ranges::views::keys | ranges::to<QStringList>();
@@ -880,6 +941,78 @@ void DatabaseManager::resetStatementCounters(const QStringList &connections)
     }
 }
 
+bool DatabaseManager::countingLatencies(const QString &connection)
+{
+    return this->connection(connection).countingLatencies();
+}
+
+DatabaseConnection &DatabaseManager::enableLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).enableLatencyHistograms();
+}
+
+DatabaseConnection &DatabaseManager::disableLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).disableLatencyHistograms();
+}
+
+std::vector<StatementLatency>
+DatabaseManager::getLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).getLatencyHistograms();
+}
+
+std::vector<StatementLatency>
+DatabaseManager::takeLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).takeLatencyHistograms();
+}
+
+DatabaseConnection &DatabaseManager::resetLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).resetLatencyHistograms();
+}
+
+void DatabaseManager::enableAllLatencyHistograms()
+{
+    for (const auto &connectionName : openedConnectionNames())
+        connection(connectionName).enableLatencyHistograms();
+}
+
+void DatabaseManager::disableAllLatencyHistograms()
+{
+    for (const auto &connectionName : openedConnectionNames())
+        connection(connectionName).disableLatencyHistograms();
+}
+
+std::vector<StatementLatency> DatabaseManager::getAllLatencyHistograms()
+{
+    std::vector<StatementLatency> statements;
+
+    for (const auto &connectionName : openedConnectionNames())
+        std::ranges::move(connection(connectionName).getLatencyHistograms(),
+                          std::back_inserter(statements));
+
+    return Support::LatencyHistograms::merge(std::move(statements));
+}
+
+std::vector<StatementLatency> DatabaseManager::takeAllLatencyHistograms()
+{
+    std::vector<StatementLatency> statements;
+
+    for (const auto &connectionName : openedConnectionNames())
+        std::ranges::move(connection(connectionName).takeLatencyHistograms(),
+                          std::back_inserter(statements));
+
+    return Support::LatencyHistograms::merge(std::move(statements));
+}
+
+void DatabaseManager::resetAllLatencyHistograms()
+{
+    for (const auto &connectionName : openedConnectionNames())
+        connection(connectionName).resetLatencyHistograms();
+}
+
 /* private */
 
 const QString &
@@ -947,8 +1080,16 @@ DatabaseManager::refreshQtConnection(const QString &connection)
        will be again resolved/connected lazily. */
     auto fresh = configure(makeConnection(connectionName));
 
-    return (*m_connections)[connectionName]->setQtConnectionResolver(
-                fresh->getQtConnectionResolver());
+    auto &connection_ = *(*m_connections)[connectionName];
+
+    // Read replicas are resolved/connected lazily again too
+    if (fresh->hasReadConnections()) {
+        auto readConnections = fresh->getReadConnections();
+
+        connection_.setReadConnections(std::move(readConnections));
+    }
+
+    return connection_.setQtConnectionResolver(fresh->getQtConnectionResolver());
 }
 
 void DatabaseManager::checkInstance()
@@ -238,6 +238,19 @@ void DB::connectEagerly(const QString &name)
     manager().connectEagerly(name);
 }
 
+/* Connection pool */
+
+Support::ConnectionLease DB::lease(const QString &connection)
+{
+    return manager().lease(connection);
+}
+
+std::shared_ptr<Support::ConnectionPool>
+DB::connectionPool(const QString &connection)
+{
+    return manager().connectionPool(connection);
+}
+
 QStringList DB::connectionNames()
 {
     return manager().connectionNames();
@@ -619,6 +632,61 @@ void DB::resetStatementCounters(const QStringList &connections)
     manager().resetStatementCounters(connections);
 }
 
+bool DB::countingLatencies(const QString &connection)
+{
+    return manager().countingLatencies(connection);
+}
+
+DatabaseConnection &DB::enableLatencyHistograms(const QString &connection)
+{
+    return manager().enableLatencyHistograms(connection);
+}
+
+DatabaseConnection &DB::disableLatencyHistograms(const QString &connection)
+{
+    return manager().disableLatencyHistograms(connection);
+}
+
+std::vector<StatementLatency> DB::getLatencyHistograms(const QString &connection)
+{
+    return manager().getLatencyHistograms(connection);
+}
+
+std::vector<StatementLatency> DB::takeLatencyHistograms(const QString &connection)
+{
+    return manager().takeLatencyHistograms(connection);
+}
+
+DatabaseConnection &DB::resetLatencyHistograms(const QString &connection)
+{
+    return manager().resetLatencyHistograms(connection);
+}
+
+void DB::enableAllLatencyHistograms()
+{
+    manager().enableAllLatencyHistograms();
+}
+
+void DB::disableAllLatencyHistograms()
+{
+    manager().disableAllLatencyHistograms();
+}
+
+std::vector<StatementLatency> DB::getAllLatencyHistograms()
+{
+    return manager().getAllLatencyHistograms();
+}
+
+std::vector<StatementLatency> DB::takeAllLatencyHistograms()
+{
+    return manager().takeAllLatencyHistograms();
+}
+
+void DB::resetAllLatencyHistograms()
+{
+    manager().resetAllLatencyHistograms();
+}
+
 /* private */
 
 DatabaseManager &DB::manager()
@@ -83,6 +83,9 @@ std::unique_ptr<QueryGrammar> PostgresConnection::getDefaultQueryGrammar() const
 
     withTablePrefix(*grammar);
 
+    // Compile the "where in" clauses as = any(?) with one array binding
+    grammar->setWhereInAsArray(getConfig(where_in_array).value<bool>());
+
     return grammar;
 }
 
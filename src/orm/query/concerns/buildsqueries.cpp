@@ -26,8 +26,10 @@ bool BuildsQueries::chunk(const qint64 count,
     do { // NOLINT(cppcoreguidelines-avoid-do-while)
         /* We'll execute the query for the given page and get the results. If there are
            no results we can just break and return from here. When there are results
-           we will call the callback with the current chunk of these results here. */
-        auto results = builder().forPage(page, count).get();
+           we will call the callback with the current chunk of these results here.
+           Every page has to be counted so it's always scrollable, it's bounded by
+           the count anyway. */
+        auto results = builder().forPage(page, count).getScrollable();
 
         countResults = static_cast<qint64>(QueryUtils::queryResultSize(results));
 
@@ -52,7 +54,7 @@ bool BuildsQueries::chunk(const qint64 count,
 bool BuildsQueries::each(const std::function<bool(SqlQuery &, qint64)> &callback,
                          const qint64 count)
 {
-    return chunk(count, [&callback](SqlQuery &results, const qint64 /*unused*/)
+    const auto eachRow = [&callback](SqlQuery &results)
     {
         qint64 index = 0;
 
@@ -63,6 +65,21 @@ bool BuildsQueries::each(const std::function<bool(SqlQuery &, qint64)> &callback
                 return false;
 
         return true;
+    };
+
+    /* The forward-only result isn't buffered on the client side, so all rows can be
+       streamed using one query with the constant memory instead of chunking. */
+    if (builder().isForwardOnly()) {
+        builder().enforceOrderBy();
+
+        auto results = builder().get();
+
+        return eachRow(results);
+    }
+
+    return chunk(count, [&eachRow](SqlQuery &results, const qint64 /*unused*/)
+    {
+        return eachRow(results);
     });
 }
 
@@ -114,7 +131,8 @@ bool BuildsQueries::chunkById(
         /* We'll execute the query for the given page and get the results. If there are
            no results we can just break and return from here. When there are results
            we will call the callback with the current chunk of these results here. */
-        auto results = clone.forPageAfterId(count, lastId, columnName, true).get();
+        auto results = clone.forPageAfterId(count, lastId, columnName, true)
+                            .getScrollable();
 
         countResults = static_cast<qint64>(QueryUtils::queryResultSize(results));
 
@@ -173,7 +191,8 @@ bool BuildsQueries::eachById(
 
 SqlQuery BuildsQueries::sole(const QVector<Column> &columns)
 {
-    auto query = builder().take(2).get(columns);
+    // Needs to be counted so it's always scrollable (max. 2 rows)
+    auto query = builder().take(2).getScrollable(columns);
 
     if (builder().getConnection().pretending())
         return query;
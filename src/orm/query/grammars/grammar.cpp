@@ -1,5 +1,7 @@
 #include "orm/query/grammars/grammar.hpp"
 
+#include <algorithm>
+
 #include "orm/databaseconnection.hpp"
 #include "orm/macros/likely.hpp"
 #include "orm/query/joinclause.hpp"
@@ -54,6 +56,21 @@ QString Grammar::compileInsert(const QueryBuilder &query,
                 columnizeWithoutWrap(compileInsertToVector(values)));
 }
 
+QString Grammar::compileInsert(const QueryBuilder &query, const QVector<QString> &columns,
+                               const QVector<QVector<QVariant>> &values) const
+{
+    QStringList compiledParameters;
+    compiledParameters.reserve(values.size());
+
+    // Raw expressions are compiled into the SQL so every row has to be parametrized
+    for (const auto &row : values)
+        compiledParameters << PARENTH_ONE.arg(parametrize(row));
+
+    return QStringLiteral("insert into %1 (%2) values %3").arg(
+                wrapTable(query.getFrom()), columnize(columns),
+                columnizeWithoutWrap(compiledParameters));
+}
+
 QString Grammar::compileInsertOrIgnore(const QueryBuilder &/*unused*/,
                                        const QVector<QVariantMap> &/*unused*/) const
 {
@@ -62,6 +79,16 @@ QString Grammar::compileInsertOrIgnore(const QueryBuilder &/*unused*/,
                 "errors.");
 }
 
+QString Grammar::compileInsertReturning(
+            const QueryBuilder &/*unused*/, const QVector<QString> &/*unused*/,
+            const QVector<QVector<QVariant>> &/*unused*/,
+            const QString &/*unused*/) const
+{
+    throw Exceptions::RuntimeError(
+                "This database engine does not support returning the generated keys "
+                "of all inserted rows.");
+}
+
 QString Grammar::compileUpdate(QueryBuilder &query,
                                const QVector<UpdateItem> &values) const
 {
@@ -78,24 +105,15 @@ QVector<QVariant>
 Grammar::prepareBindingsForUpdate(const BindingsMap &bindings, // NOLINT(readability-convert-member-functions-to-static)
                                   const QVector<UpdateItem> &values) const
 {
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic push
-#  pragma GCC diagnostic ignored "-Wdangling-reference"
-#endif
-    const auto &joinBindings = bindings.find(BindingType::JOIN).value();
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic pop
-#endif
+    const auto joinBindings = bindings.at(BindingType::JOIN);
 
     QVector<QVariant> preparedBindings;
-    preparedBindings.reserve(
-                joinBindings.size() + values.size() +
-                // Rest of the bindings
-                computeReserveForBindingsMap(bindings, {BindingType::SELECT,
-                                                        BindingType::JOIN}));
+    // Join bindings, update values, and the rest of the bindings (select is excluded)
+    preparedBindings.reserve(bindings.size() - bindings.size(BindingType::SELECT) +
+                             values.size());
 
     // Join bindings have to go first, I don't remember why 🫤
-    preparedBindings << joinBindings;
+    std::ranges::copy(joinBindings, std::back_inserter(preparedBindings));
 
     // Merge update values bindings
     std::transform(values.cbegin(), values.cend(), std::back_inserter(preparedBindings),
@@ -104,17 +122,61 @@ Grammar::prepareBindingsForUpdate(const BindingsMap &bindings, // NOLINT(readabi
         return updateItem.value;
     });
 
-    /* Flatten bindings map and exclude select and join bindings and than merge
-       all remaining bindings from flatten bindings map. */
-    const auto flatten = flatBindingsForUpdateDelete(bindings, {BindingType::SELECT,
-                                                                BindingType::JOIN});
-
-    // std::copy() is ok, 'flatten' contains vector of references
-    std::copy(flatten.cbegin(), flatten.cend(), std::back_inserter(preparedBindings));
+    // Merge all remaining bindings, exclude select and join bindings
+    appendBindingsExcept(preparedBindings, bindings, {BindingType::SELECT,
+                                                      BindingType::JOIN});
 
     return preparedBindings;
 }
 
+QString Grammar::compileUpdateBatch(const QueryBuilder &query,
+                                    const QVector<QString> &columns,
+                                    const QVector<QVector<QVariant>> &values,
+                                    const QString &uniqueBy) const
+{
+    const auto uniqueIndex = columns.indexOf(uniqueBy);
+    const auto uniqueColumn = wrap(uniqueBy);
+
+    QStringList compiledColumns;
+    compiledColumns.reserve(columns.size() - 1);
+
+    /* Every column gets its own case expression, the else branch keeps the current
+       value and it also gives the PostgreSQL the type of the bound values. */
+    for (QVector<QString>::size_type index = 0; index < columns.size(); ++index) {
+        if (index == uniqueIndex)
+            continue;
+
+        const auto column = wrap(columns.at(index));
+
+        QString compiledCase = QStringLiteral("%1 = case %2").arg(column, uniqueColumn);
+
+        for (const auto &row : values)
+            compiledCase += QStringLiteral(" when %1 then %2")
+                            .arg(parameter(row.at(uniqueIndex)),
+                                 parameter(row.at(index)));
+
+        compiledColumns << QStringLiteral("%1 else %2 end").arg(compiledCase, column);
+    }
+
+    QVector<QVariant> uniqueValues;
+    uniqueValues.reserve(values.size());
+
+    for (const auto &row : values)
+        uniqueValues << row.at(uniqueIndex);
+
+    auto sql = QStringLiteral("update %1 set %2 where %3 in (%4)")
+               .arg(wrapTable(query.getFrom()), columnizeWithoutWrap(compiledColumns),
+                    uniqueColumn, parametrize(uniqueValues));
+
+    // The query constraints are compiled after the unique column constraint
+    if (const auto wheres = compileWheresToVector(query);
+        !wheres.isEmpty()
+    )
+        sql += QStringLiteral(" and (%1)").arg(removeLeadingBoolean(wheres.join(SPACE)));
+
+    return sql;
+}
+
 QString Grammar::compileUpsert(
             QueryBuilder &/*unused*/, const QVector<QVariantMap> &/*unused*/,
             const QStringList &/*unused*/, const QStringList &/*unused*/) const
@@ -133,16 +195,15 @@ QString Grammar::compileDelete(QueryBuilder &query) const
 
 QVector<QVariant> Grammar::prepareBindingsForDelete(const BindingsMap &bindings) const  // NOLINT(readability-convert-member-functions-to-static)
 {
-    QVector<QVariant> preparedBindings;
-    preparedBindings.reserve(
-                computeReserveForBindingsMap(bindings, {BindingType::SELECT}));
+    // Fast path, no select bindings to exclude, share all the bindings (no copy)
+    if (bindings.size(BindingType::SELECT) == 0)
+        return bindings.all();
 
-    /* Flatten bindings map and exclude select bindings and than merge all remaining
-       bindings from flatten bindings map. */
-    const auto flatten = flatBindingsForUpdateDelete(bindings, {BindingType::SELECT});
+    QVector<QVariant> preparedBindings;
+    preparedBindings.reserve(bindings.size() - bindings.size(BindingType::SELECT));
 
-    // std::copy() is ok, 'flatten' contains vector of references
-    std::copy(flatten.cbegin(), flatten.cend(), std::back_inserter(preparedBindings));
+    // Merge all remaining bindings, exclude select bindings
+    appendBindingsExcept(preparedBindings, bindings, {BindingType::SELECT});
 
     return preparedBindings;
 }
@@ -167,6 +228,13 @@ const std::unordered_set<QString> &Grammar::getOperators() const
     return cachedOperators;
 }
 
+QVariant Grammar::whereInArrayBinding(const QVector<QVariant> &/*unused*/) const
+{
+    throw Exceptions::RuntimeError(
+                "This database engine does not support the array binding "
+                "for the 'where in' clause.");
+}
+
 /* protected */
 
 bool Grammar::shouldCompileAggregate(const std::optional<AggregateItem> &aggregate)
@@ -666,40 +734,16 @@ QString Grammar::removeLeadingBoolean(QString &&statement)
     return std::move(statement);
 }
 
-QVector<std::reference_wrapper<const QVariant>>
-Grammar::flatBindingsForUpdateDelete(const BindingsMap &bindings,
-                                     const QVector<BindingType> &exclude)
-{
-    QVector<std::reference_wrapper<const QVariant>> cleanBindingsFlatten;
-    cleanBindingsFlatten.reserve(computeReserveForBindingsMap(bindings, exclude));
-
-    for (auto itBindings = bindings.constBegin();
-         itBindings != bindings.constEnd(); ++itBindings
-    )
-        if (!exclude.isEmpty() && exclude.contains(itBindings.key()))
-            continue;
-        else
-            for (const auto &binding : itBindings.value())
-                cleanBindingsFlatten << std::cref(binding);
-
-    return cleanBindingsFlatten;
-}
-
-QVector<QVariant>::size_type
-Grammar::computeReserveForBindingsMap(const BindingsMap &bindings,
-                                      const QVector<BindingType> &exclude)
+void Grammar::appendBindingsExcept(QVector<QVariant> &preparedBindings,
+                                   const BindingsMap &bindings,
+                                   const std::initializer_list<BindingType> exclude)
 {
-    QVector<QVariant>::size_type size = 0;
-
-    for (auto itBindings = bindings.constBegin();
-         itBindings != bindings.constEnd(); ++itBindings
-    )
-        if (!exclude.isEmpty() && exclude.contains(itBindings.key()))
-            continue;
-        else
-            size += itBindings.value().size();
-
-    return size;
+    for (std::size_t type = 0; type < BindingsMap::TypesCount; ++type)
+        if (const auto bindingType = static_cast<BindingType>(type);
+            std::ranges::find(exclude, bindingType) == exclude.end()
+        )
+            std::ranges::copy(bindings.at(bindingType),
+                              std::back_inserter(preparedBindings));
 }
 
 } // namespace Orm::Query::Grammars
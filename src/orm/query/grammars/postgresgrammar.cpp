@@ -1,9 +1,14 @@
 #include "orm/query/grammars/postgresgrammar.hpp"
 
+#include <algorithm>
+
 #include "orm/query/querybuilder.hpp"
+#include "orm/utils/helpers.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Utils::Helpers;
+
 namespace Orm::Query::Grammars
 {
 
@@ -24,6 +29,15 @@ QString PostgresGrammar::compileInsertGetId(const QueryBuilder &query,
                  wrap(sequence.isEmpty() ? ID : sequence));
 }
 
+QString PostgresGrammar::compileInsertReturning(
+            const QueryBuilder &query, const QVector<QString> &columns,
+            const QVector<QVector<QVariant>> &values, const QString &sequence) const
+{
+    return QStringLiteral("%1 returning %2")
+            .arg(compileInsert(query, columns, values),
+                 wrap(sequence.isEmpty() ? ID : sequence));
+}
+
 QString PostgresGrammar::compileUpdate(QueryBuilder &query,
                                        const QVector<UpdateItem> &values) const
 {
@@ -93,6 +107,36 @@ const std::unordered_set<QString> &PostgresGrammar::getOperators() const
     return cachedOperators;
 }
 
+bool PostgresGrammar::bindsWhereInAsArray(const QVector<QVariant> &values) const noexcept
+{
+    /* The empty "where in" is compiled without bindings and expressions must be
+       compiled into the query, other values are bound one by one if they can't
+       be converted to the array literal element (eg. QDateTime-s must be converted
+       to the connection's time zone in the prepareBindings()). */
+    return m_whereInAsArray && !values.isEmpty() &&
+           std::all_of(values.cbegin(), values.cend(), isArrayElement);
+}
+
+QVariant PostgresGrammar::whereInArrayBinding(const QVector<QVariant> &values) const
+{
+    Q_ASSERT(bindsWhereInAsArray(values));
+
+    QStringList elements;
+    elements.reserve(values.size());
+
+    for (const auto &value : values)
+        elements << toArrayElement(value);
+
+    return QStringLiteral("{%1}").arg(elements.join(COMMA_C));
+}
+
+PostgresGrammar &PostgresGrammar::setWhereInAsArray(const bool value) noexcept
+{
+    m_whereInAsArray = value;
+
+    return *this;
+}
+
 QString PostgresGrammar::whereBasic(const WhereConditionItem &where) const
 {
     if (!where.comparison.contains(LIKE, Qt::CaseInsensitive))
@@ -226,6 +270,22 @@ QString PostgresGrammar::compileColumns(const QueryBuilder &query) const
     return select += columnize(query.getColumns());
 }
 
+QString PostgresGrammar::whereIn(const WhereConditionItem &where) const
+{
+    if (!bindsWhereInAsArray(where.values))
+        return Grammar::whereIn(where);
+
+    return QStringLiteral("%1 = any(?)").arg(wrap(where.column));
+}
+
+QString PostgresGrammar::whereNotIn(const WhereConditionItem &where) const
+{
+    if (!bindsWhereInAsArray(where.values))
+        return Grammar::whereNotIn(where);
+
+    return QStringLiteral("%1 <> all(?)").arg(wrap(where.column));
+}
+
 QString PostgresGrammar::whereDate(const WhereConditionItem &where) const
 {
     return QStringLiteral("%1::date %3 %4").arg(wrap(where.column),
@@ -264,6 +324,44 @@ QString PostgresGrammar::compileUpdateColumns(const QVector<UpdateItem> &values)
 
 /* private */
 
+bool PostgresGrammar::isArrayElement(const QVariant &value)
+{
+    if (value.isNull())
+        return true;
+
+    switch (Helpers::qVariantTypeId(value)) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Double:
+    case QMetaType::QString:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+QString PostgresGrammar::toArrayElement(const QVariant &value)
+{
+    if (value.isNull())
+        return QStringLiteral("NULL");
+
+    if (Helpers::qVariantTypeId(value) != QMetaType::QString)
+        return value.value<QString>();
+
+    /* Strings are always double-quoted so empty strings, whitespaces, commas,
+       braces, and the NULL word are preserved. */
+    auto element = value.value<QString>();
+
+    element.replace(QStringLiteral("\\"), QStringLiteral("\\\\"))
+           .replace(QStringLiteral("\""), QStringLiteral("\\\""));
+
+    return QStringLiteral("\"%1\"").arg(element);
+}
+
 QString PostgresGrammar::compileUpdateWithJoinsOrLimit(
         QueryBuilder &query, const QVector<UpdateItem> &values) const
 {
@@ -13,8 +13,8 @@ namespace Orm::Query::Processors
 QStringList SQLiteProcessor::processColumnListing(SqlQuery &query) const
 {
     QStringList columns;
-    columns.reserve(static_cast<decltype (columns)::size_type>(
-                        QueryUtils::queryResultSize(query)));
+    if (const auto size = QueryUtils::queryResultSizeHint(query); size)
+        columns.reserve(static_cast<decltype (columns)::size_type>(*size));
 
     while (query.next())
         columns << query.value(NAME).value<QString>();
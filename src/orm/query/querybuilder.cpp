@@ -2,6 +2,8 @@
 
 #include <QDebug>
 
+#include <algorithm>
+
 #include <range/v3/view/remove_if.hpp>
 
 #include "orm/databaseconnection.hpp"
@@ -36,6 +38,11 @@ SqlQuery Builder::get(const QVector<Column> &columns)
     });
 }
 
+Cursor<> Builder::cursor(const QVector<Column> &columns)
+{
+    return Cursor<>(getForwardOnly(columns));
+}
+
 SqlQuery Builder::find(const QVariant &id, const QVector<Column> &columns)
 {
     return where(ID, EQ, id).first(columns);
@@ -113,19 +120,16 @@ QVector<QVariant> Builder::pluck(const Column &column)
        and get the exact data that was requested for the query. */
     auto query = get({column});
 
-    const auto size = QueryUtils::queryResultSize(query);
-
-    // Empty result
-    if (size == 0)
-        return {};
-
     /* If the column is qualified with a table or have an alias, we cannot use
        those directly in the "pluck" operations, we have to strip the table out or
        use the alias name instead. */
     const auto unqualifiedColumn = stripTableForPluck(column);
 
     QVector<QVariant> result;
-    result.reserve(size);
+    /* Don't seek to count the result, it doesn't work in the forward-only mode and
+       the empty result is detected by the first next() call anyway. */
+    if (const auto size = QueryUtils::queryResultSizeHint(query, m_limit); size)
+        result.reserve(*size);
 
     while (query.next())
         result << query.value(unqualifiedColumn);
@@ -167,6 +171,51 @@ namespace
 
         return flattenValues;
     };
+
+    /*! Throw if the columns are empty or any row has a different number of values. */
+    void throwIfInvalidRows(const QVector<QString> &columns,
+                            const QVector<QVector<QVariant>> &values,
+                            const QString &functionName)
+    {
+        if (columns.isEmpty())
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The columns argument can't be empty in %1().")
+                    .arg(functionName));
+
+        const auto columnsSize = columns.size();
+
+        // Validate all rows before the first batch is executed
+        for (const auto &row : values)
+            if (row.size() != columnsSize)
+                throw Exceptions::InvalidArgumentError(
+                        QStringLiteral("A columns and values arguments don't have "
+                                       "the same number of items in %1().")
+                        .arg(functionName));
+    }
+
+    /*! Flat bindings for the batched update statement (case bindings first). */
+    QVector<QVariant>
+    flatValuesForUpdateBatch(const QVector<QVector<QVariant>> &values,
+                             const QVector<QVariant>::size_type columnsSize,
+                             const QVector<QVariant>::size_type uniqueIndex)
+    {
+        QVector<QVariant> flattenValues;
+        flattenValues.reserve(values.size() * (((columnsSize - 1) * 2) + 1));
+
+        // The same order as the Grammar::compileUpdateBatch() compiles placeholders
+        for (QVector<QVariant>::size_type index = 0; index < columnsSize; ++index) {
+            if (index == uniqueIndex)
+                continue;
+
+            for (const auto &row : values)
+                flattenValues << row.at(uniqueIndex) << row.at(index);
+        }
+
+        for (const auto &row : values)
+            flattenValues << row.at(uniqueIndex);
+
+        return flattenValues;
+    }
 } // namespace
 
 /* Insert, Update, Delete */
@@ -202,6 +251,54 @@ Builder::insert(const QVector<QString> &columns,
     return insert(QueryUtils::zipForInsert(columns, values));
 }
 
+qint64 Builder::insertBatched(const QVector<QString> &columns,
+                              const QVector<QVector<QVariant>> &values,
+                              const bool transaction)
+{
+    if (values.isEmpty())
+        return 0;
+
+    throwIfInvalidRows(columns, values, __tiny_func__);
+
+    const auto columnsSize = columns.size();
+
+    using SizeType = std::remove_cvref_t<decltype (values)>::size_type;
+
+    // Number of rows in one insert statement, every row needs columnsSize parameters
+    const auto batchSize = std::max<SizeType>(
+                               1, m_grammar->getMaxParameters() / columnsSize);
+
+    // Don't start the transaction if there is only one batch or we are already in it
+    const auto useTransaction = transaction && values.size() > batchSize &&
+                                !m_connection->inTransaction();
+
+    if (useTransaction)
+        m_connection->beginTransaction();
+
+    qint64 inserted = 0;
+
+    try {
+        for (SizeType offset = 0; offset < values.size(); offset += batchSize) {
+            const auto batch = values.mid(offset, batchSize);
+
+            inserted += std::get<0>(m_connection->affectingStatement(
+                                        m_grammar->compileInsert(*this, columns, batch),
+                                        cleanBindings(flatValuesForInsert(batch))));
+        }
+
+    } catch (...) {
+        if (useTransaction)
+            m_connection->rollBack();
+
+        throw;
+    }
+
+    if (useTransaction)
+        m_connection->commit();
+
+    return inserted;
+}
+
 // FEATURE dilemma primarykey, add support for Model::KeyType in QueryBuilder/TinyBuilder or should it be QVariant and runtime type check? 🤔 silverqx
 quint64 Builder::insertGetId(const QVariantMap &values, const QString &sequence)
 {
@@ -215,6 +312,41 @@ quint64 Builder::insertGetId(const QVariantMap &values, const QString &sequence)
     return query.lastInsertId().value<quint64>();
 }
 
+QVector<QVariant>
+Builder::insertGetIds(const QVector<QString> &columns,
+                      const QVector<QVector<QVariant>> &values, const QString &sequence)
+{
+    if (values.isEmpty())
+        return {};
+
+    throwIfInvalidRows(columns, values, __tiny_func__);
+
+    using SizeType = std::remove_cvref_t<decltype (values)>::size_type;
+
+    // Number of rows in one insert statement, every row needs columns.size() parameters
+    const auto batchSize = std::max<SizeType>(
+                               1, m_grammar->getMaxParameters() / columns.size());
+
+    QVector<QVariant> ids;
+    ids.reserve(values.size());
+
+    for (SizeType offset = 0; offset < values.size(); offset += batchSize) {
+        const auto batch = values.mid(offset, batchSize);
+
+        auto query = m_connection->insert(
+                         m_grammar->compileInsertReturning(*this, columns, batch,
+                                                           sequence),
+                         cleanBindings(flatValuesForInsert(batch)));
+
+        /* Keep the order of the returned rows, the keys don't have to be ascending
+           (eg. a sequence with a negative increment or keys from a trigger). */
+        while (query.next())
+            ids << query.value(0);
+    }
+
+    return ids;
+}
+
 std::tuple<int, std::optional<QSqlQuery>>
 Builder::insertOrIgnore(const QVector<QVariantMap> &values)
 {
@@ -248,6 +380,62 @@ Builder::update(const QVector<UpdateItem> &values)
                                                                   values)));
 }
 
+qint64 Builder::updateBatch(const QVector<QString> &columns,
+                            const QVector<QVector<QVariant>> &values,
+                            const QString &uniqueBy)
+{
+    if (values.isEmpty())
+        return 0;
+
+    throwIfInvalidRows(columns, values, __tiny_func__);
+
+    const auto uniqueIndex = columns.indexOf(uniqueBy);
+
+    if (uniqueIndex == -1)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' unique column has to be one of the columns "
+                               "in %2().")
+                .arg(uniqueBy, __tiny_func__));
+
+    // The case expressions can't be compiled with the joins
+    if (!m_joins.isEmpty())
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The joins are not supported in %1().")
+                .arg(__tiny_func__));
+
+    // Nothing to update, there is only the unique column
+    if (columns.size() == 1)
+        return 0;
+
+    using SizeType = std::remove_cvref_t<decltype (values)>::size_type;
+
+    // The query constraints are bound after the unique column values
+    const auto whereBindings = m_bindings.value(BindingType::WHERE);
+
+    /* Number of rows in one update statement, every row needs two parameters for
+       every updated column and one parameter for the where in clause. */
+    const auto batchSize = std::max<SizeType>(
+                               1, (m_grammar->getMaxParameters() -
+                                   whereBindings.size()) /
+                                  (((columns.size() - 1) * 2) + 1));
+
+    qint64 updated = 0;
+
+    for (SizeType offset = 0; offset < values.size(); offset += batchSize) {
+        const auto batch = values.mid(offset, batchSize);
+
+        auto bindings = flatValuesForUpdateBatch(batch, columns.size(), uniqueIndex);
+        bindings << whereBindings;
+
+        updated += std::get<0>(m_connection->update(
+                                   m_grammar->compileUpdateBatch(*this, columns, batch,
+                                                                 uniqueBy),
+                                   cleanBindings(std::move(bindings))));
+    }
+
+    return updated;
+}
+
 namespace
 {
     /*! Merge attributes and values for the updateOrInsert() method. */
@@ -283,6 +471,15 @@ Builder::updateOrInsert(const QVector<WhereItem> &attributes,
 
 namespace
 {
+    /*! Determine whether the given bindings contain an expression. */
+    const auto containsExpression = [](const QVector<QVariant> &bindings)
+    {
+        return std::ranges::any_of(bindings, [](const QVariant &binding)
+        {
+            return binding.canConvert<Expression>();
+        });
+    };
+
     /*! Flat bindings map for an upsert statement (proxy method for better naming). */
     const auto flatValuesForUpsert = [](auto &&values)
     {
@@ -307,21 +504,21 @@ Builder::upsert(const QVector<QVariantMap> &values, const QStringList &uniqueBy,
                     "please use the 'insert' method instead in %1().")
                 .arg(__tiny_func__));
 
-    return m_connection->affectingStatement(
-                m_grammar->compileUpsert(*this, values, uniqueBy, update),
-                cleanBindings(flatValuesForUpsert(values)));
+    return upsertInternal(values, uniqueBy, update);
 }
 
 std::tuple<int, std::optional<QSqlQuery>>
 Builder::upsert(const QVector<QVariantMap> &values, const QStringList &uniqueBy)
 {
+    // Nothing to do, no values to insert or update
+    if (values.isEmpty())
+        return {0, std::nullopt};
+
     // Update all columns
     // Columns are obtained only from a first QMap
     const auto update = values.constFirst().keys();
 
-    return m_connection->affectingStatement(
-                m_grammar->compileUpsert(*this, values, uniqueBy, update),
-                cleanBindings(flatValuesForUpsert(values)));
+    return upsertInternal(values, uniqueBy, update);
 }
 
 std::tuple<int, QSqlQuery> Builder::deleteRow()
@@ -352,10 +549,13 @@ void Builder::truncate()
 QVariant Builder::aggregate(const QString &function,
                             const QVector<Column> &columns) const
 {
-    auto resultsQuery = cloneWithout({PropertyType::COLUMNS})
-                        .cloneWithoutBindings({BindingType::SELECT})
-                        .setAggregate(function, columns)
-                        .get(columns);
+    /* Clone the query only once, the same as the cloneWithout({COLUMNS})
+       and cloneWithoutBindings({SELECT}), query parts are implicitly shared. */
+    auto query = clone();
+    query.m_columns = QVector<Column>();
+    query.m_bindings.clear(BindingType::SELECT);
+
+    auto resultsQuery = query.setAggregate(function, columns).get(columns);
 
     // Empty result
     if (!resultsQuery.first())
@@ -366,7 +566,8 @@ QVariant Builder::aggregate(const QString &function,
 
 bool Builder::exists()
 {
-    auto results = m_connection->select(m_grammar->compileExists(*this), getBindings());
+    auto results = m_connection->select(m_grammar->compileExists(*this), getBindings(),
+                                        std::nullopt, !m_useWriteConnection);
 
     /* If the results have rows, we will get the row and see if the exists column is a
        boolean true. If there are no results for this query we will return false as
@@ -659,10 +860,16 @@ Builder &Builder::whereIn(const Column &column, const QVector<QVariant> &values,
     m_wheres.append({.column = column, .condition = condition, .type = type,
                      .values = values});
 
+    /* The grammar can bind all values as one array binding, this keeps the same
+       SQL query for any number of values (eg. "id" = any(?) on PostgreSQL). */
+    if (m_grammar->bindsWhereInAsArray(values))
+        addBinding(m_grammar->whereInArrayBinding(values), BindingType::WHERE);
+
     /* Finally we'll add a binding for each values unless that value is an expression
        in which case we will just skip over it since it will be the query as a raw
        string and not as a parameterized place-holder to be replaced by the DB driver. */
-    addBinding(cleanBindings(values), BindingType::WHERE);
+    else
+        addBinding(cleanBindings(values), BindingType::WHERE);
 
     return *this;
 }
@@ -1061,7 +1268,7 @@ Builder &Builder::reorder()
 {
     m_orders.clear();
 
-    m_bindings[BindingType::ORDER].clear();
+    m_bindings.clear(BindingType::ORDER);
 
     return *this;
 }
@@ -1161,11 +1368,8 @@ Builder &Builder::lock(const bool value)
 {
     m_lock = value;
 
-    // FEATURE read/write connection silverqx
-//    if (! is_null($this->lock))
-//        useWritePdo();
-
-    return *this;
+    // Locked rows have to be selected from the write connection
+    return useWriteConnection();
 }
 
 Builder &Builder::lock(const char *value)
@@ -1175,20 +1379,43 @@ Builder &Builder::lock(const char *value)
        https://stackoverflow.com/questions/14770252/string-literal-matches-bool-overload-instead-of-stdstring */
     m_lock = QString(value);
 
-    return *this;
+    return useWriteConnection();
 }
 
 Builder &Builder::lock(const QString &value)
 {
     m_lock = value;
 
-    return *this;
+    return useWriteConnection();
 }
 
 Builder &Builder::lock(QString &&value)
 {
     m_lock = std::move(value);
 
+    return useWriteConnection();
+}
+
+/* Forward-only mode */
+
+Builder &Builder::forwardOnly(const bool value)
+{
+    m_forwardOnly = value;
+
+    return *this;
+}
+
+bool Builder::isForwardOnly() const
+{
+    return m_forwardOnly.value_or(m_connection->isForwardOnly());
+}
+
+/* Read/write connections */
+
+Builder &Builder::useWriteConnection(const bool value)
+{
+    m_useWriteConnection = value;
+
     return *this;
 }
 
@@ -1232,13 +1459,8 @@ const QString &Builder::defaultKeyName() const noexcept // NOLINT(readability-co
 
 QVector<QVariant> Builder::getBindings() const
 {
-    QVector<QVariant> flattenBindings;
-
-    for (const auto &bindings : std::as_const(m_bindings))
-        for (const auto &binding : bindings)
-            flattenBindings << binding;
-
-    return flattenBindings;
+    // Bindings are already flat and ordered by the binding type, shared (no copy)
+    return m_bindings.all();
 }
 
 Builder &Builder::addBinding(const QVariant &binding, const BindingType type)
@@ -1248,7 +1470,7 @@ Builder &Builder::addBinding(const QVariant &binding, const BindingType type)
     checkBindingType(type);
 #endif
 
-    m_bindings[type] << binding;
+    m_bindings.append(type, binding);
 
     return *this;
 }
@@ -1260,7 +1482,7 @@ Builder &Builder::addBinding(QVariant &&binding, const BindingType type)
     checkBindingType(type);
 #endif
 
-    m_bindings[type] << std::move(binding);
+    m_bindings.append(type, std::move(binding));
 
     return *this;
 }
@@ -1272,8 +1494,7 @@ Builder &Builder::addBinding(const QVector<QVariant> &bindings, const BindingTyp
     checkBindingType(type);
 #endif
 
-    if (!bindings.isEmpty())
-        std::ranges::copy(bindings, std::back_inserter(m_bindings[type]));
+    m_bindings.append(type, bindings);
 
     return *this;
 }
@@ -1285,12 +1506,7 @@ Builder &Builder::addBinding(QVector<QVariant> &&bindings, const BindingType typ
     checkBindingType(type);
 #endif
 
-    if (bindings.isEmpty())
-        return *this;
-
-    auto &bindingsRef = m_bindings[type]; // clazy:exclude=detaching-member
-    bindingsRef.reserve(bindings.size());
-    std::ranges::move(bindings, std::back_inserter(bindingsRef));
+    m_bindings.append(type, std::move(bindings));
 
     return *this;
 }
@@ -1302,10 +1518,7 @@ Builder &Builder::setBindings(QVector<QVariant> &&bindings, const BindingType ty
     checkBindingType(type);
 #endif
 
-    auto &bindingsRef = m_bindings[type]; // clazy:exclude=detaching-member
-
-    bindingsRef.reserve(bindings.size());
-    bindingsRef = std::move(bindings);
+    m_bindings.set(type, std::move(bindings));
 
     return *this;
 }
@@ -1356,16 +1569,8 @@ Builder &Builder::addNestedWhereQuery(const std::shared_ptr<Builder> &query,
     m_wheres.append({.column = {}, .condition = condition, .type = WhereType::NESTED,
                      .nestedQuery = query});
 
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic push
-#  pragma GCC diagnostic ignored "-Wdangling-reference"
-#endif
-    const auto &whereBindings = query->getRawBindings().find(BindingType::WHERE).value();
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic pop
-#endif
-
-    addBinding(whereBindings, BindingType::WHERE);
+    m_bindings.append(BindingType::WHERE,
+                      query->getRawBindings().at(BindingType::WHERE));
 
     return *this;
 }
@@ -1403,7 +1608,7 @@ Builder &Builder::mergeWheres(const QVector<WhereConditionItem> &wheres,
 {
     m_wheres += wheres;
 
-    m_bindings[BindingType::WHERE] += bindings;
+    m_bindings.append(BindingType::WHERE, bindings);
 
     return *this;
 }
@@ -1414,9 +1619,7 @@ Builder::mergeWheres(QVector<WhereConditionItem> &&wheres, QVector<QVariant> &&b
     m_wheres.reserve(wheres.size());
     std::ranges::move(wheres, std::back_inserter(m_wheres));
 
-    auto &bindingsRef = m_bindings[BindingType::WHERE]; // clazy:exclude=detaching-member
-    bindingsRef.reserve(bindings.size());
-    std::ranges::move(bindings, std::back_inserter(bindingsRef));
+    m_bindings.append(BindingType::WHERE, std::move(bindings));
 
     return *this;
 }
@@ -1428,7 +1631,8 @@ Builder Builder::cloneWithout(const std::unordered_set<PropertyType> &properties
     for (const auto property : properties)
         switch (property) { // NOLINT(hicpp-multiway-paths-covered)
         case PropertyType::COLUMNS:
-            copy.m_columns.clear();
+            // Don't detach the shared columns (Qt6 clear() allocates)
+            copy.m_columns = QVector<Column>();
             break;
 
         default:
@@ -1446,7 +1650,7 @@ Builder Builder::cloneWithoutBindings(
     for (const auto bindingType : except)
         switch (bindingType) { // NOLINT(hicpp-multiway-paths-covered)
         case BindingType::SELECT:
-            copy.m_bindings[BindingType::SELECT].clear();
+            copy.m_bindings.clear(BindingType::SELECT);
             break;
 
         default:
@@ -1475,6 +1679,10 @@ void Builder::throwIfInvalidOperator(const QString &comparison) const
 
 QVector<QVariant> Builder::cleanBindings(const QVector<QVariant> &bindings)
 {
+    // Fast path, nothing to clean, share the bindings (no copy)
+    if (!containsExpression(bindings))
+        return bindings;
+
     QVector<QVariant> cleanedBindings;
     cleanedBindings.reserve(bindings.size());
 
@@ -1487,6 +1695,10 @@ QVector<QVariant> Builder::cleanBindings(const QVector<QVariant> &bindings)
 
 QVector<QVariant> Builder::cleanBindings(QVector<QVariant> &&bindings) // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
 {
+    // Fast path, nothing to clean
+    if (!containsExpression(bindings))
+        return std::move(bindings);
+
     QVector<QVariant> cleanedBindings;
     cleanedBindings.reserve(bindings.size());
 
@@ -1565,7 +1777,7 @@ Builder &Builder::clearColumns()
 {
     m_columns.clear();
 
-    m_bindings[BindingType::SELECT].clear();
+    m_bindings.clear(BindingType::SELECT);
 
     return *this;
 }
@@ -1688,7 +1900,7 @@ Builder &Builder::setAggregate(const QString &function, const QVector<Column> &c
     if (m_groups.isEmpty()) {
         m_orders.clear();
 
-        m_bindings[BindingType::ORDER].clear();
+        m_bindings.clear(BindingType::ORDER);
     }
 
     return *this;
@@ -1696,9 +1908,27 @@ Builder &Builder::setAggregate(const QString &function, const QVector<Column> &c
 
 /* private */
 
-SqlQuery Builder::runSelect()
+SqlQuery Builder::runSelect(const std::optional<bool> forwardOnly)
+{
+    return m_connection->select(toSql(), getBindings(),
+                                forwardOnly ? forwardOnly : m_forwardOnly,
+                                !m_useWriteConnection);
+}
+
+SqlQuery Builder::getScrollable(const QVector<Column> &columns)
 {
-    return m_connection->select(toSql(), getBindings());
+    return onceWithColumns(columns, [this]
+    {
+        return runSelect(false);
+    });
+}
+
+SqlQuery Builder::getForwardOnly(const QVector<Column> &columns)
+{
+    return onceWithColumns(columns, [this]
+    {
+        return runSelect(true);
+    });
 }
 
 Builder &Builder::joinInternal(
@@ -1781,9 +2011,61 @@ Builder &Builder::whereInternal(
     return *this;
 }
 
+std::tuple<int, std::optional<QSqlQuery>>
+Builder::upsertInternal(const QVector<QVariantMap> &values, const QStringList &uniqueBy,
+                        const QStringList &update)
+{
+    using SizeType = std::remove_cvref_t<decltype (values)>::size_type;
+
+    // Number of rows in one upsert statement, columns are obtained from a first QMap
+    const auto batchSize = std::max<SizeType>(
+                               1, m_grammar->getMaxParameters() /
+                                  std::max<SizeType>(1, values.constFirst().size()));
+
+    // Fast path, all rows fit into one statement
+    if (values.size() <= batchSize)
+        return m_connection->affectingStatement(
+                    m_grammar->compileUpsert(*this, values, uniqueBy, update),
+                    cleanBindings(flatValuesForUpsert(values)));
+
+    // Don't start the transaction if we are already in it
+    const auto useTransaction = !m_connection->inTransaction();
+
+    if (useTransaction)
+        m_connection->beginTransaction();
+
+    int affected = 0;
+    std::optional<QSqlQuery> lastQuery;
+
+    try {
+        for (SizeType offset = 0; offset < values.size(); offset += batchSize) {
+            const auto batch = values.mid(offset, batchSize);
+
+            auto [batchAffected, query] = m_connection->affectingStatement(
+                                              m_grammar->compileUpsert(
+                                                  *this, batch, uniqueBy, update),
+                                              cleanBindings(flatValuesForUpsert(batch)));
+
+            affected += batchAffected;
+            lastQuery = std::move(query);
+        }
+
+    } catch (...) {
+        if (useTransaction)
+            m_connection->rollBack();
+
+        throw;
+    }
+
+    if (useTransaction)
+        m_connection->commit();
+
+    return {affected, std::move(lastQuery)};
+}
+
 void Builder::checkBindingType(const BindingType type) const
 {
-    if (m_bindings.contains(type))
+    if (BindingsMap::contains(type))
         return;
 
     // TODO add hash which maps BindingType to the QString silverqx
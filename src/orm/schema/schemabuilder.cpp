@@ -7,12 +7,9 @@
 
 #include "orm/databaseconnection.hpp"
 #include "orm/exceptions/logicerror.hpp"
-#include "orm/utils/query.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
-using QueryUtils = Orm::Utils::Query;
-
 namespace Orm::SchemaNs
 {
 
@@ -183,7 +180,8 @@ bool SchemaBuilder::hasTable(const QString &table) const
     auto query = m_connection->selectFromWriteConnection(
                      m_grammar->compileTableExists(), {table_});
 
-    return QueryUtils::queryResultSize(query) > 0;
+    // Doesn't need to seek, works with the forward-only query too
+    return query.next();
 }
 
 // TEST schema, test in functional tests silverqx
@@ -1,12 +1,19 @@
 #include "orm/sqliteconnection.hpp"
 
+#include <QtSql/QSqlQuery>
+
 #include "orm/query/grammars/sqlitegrammar.hpp"
 #include "orm/query/processors/sqliteprocessor.hpp"
 #include "orm/schema/grammars/sqliteschemagrammar.hpp"
 #include "orm/schema/sqliteschemabuilder.hpp"
+#include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Constants::optimize_on_disconnect;
+
+using TypeUtils = Orm::Utils::Type;
+
 namespace Orm
 {
 
@@ -70,6 +77,23 @@ std::unique_ptr<QueryProcessor> SQLiteConnection::getDefaultPostProcessor() cons
     return std::make_unique<Query::Processors::SQLiteProcessor>();
 }
 
+void SQLiteConnection::beforeDisconnect()
+{
+    if (!TypeUtils::isTrue(getConfig(optimize_on_disconnect)))
+        return;
+
+    auto connection = getRawQtConnection();
+
+    // Nothing to optimize
+    if (!connection.isOpen())
+        return;
+
+    /* Gather statistics for the query planner, it's cheap when there is nothing to do,
+       it's an optimization only so errors are ignored, the disconnect can't fail. */
+    QSqlQuery query(connection);
+    std::ignore = query.exec(QStringLiteral("PRAGMA optimize;"));
+}
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
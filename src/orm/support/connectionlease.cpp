@@ -0,0 +1,127 @@
+#include "orm/support/connectionlease.hpp"
+
+#include <QtSql/QSqlQuery>
+
+#include "orm/constants.hpp"
+#include "orm/databaseconnection.hpp"
+#include "orm/support/connectionpool.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+#ifdef TINYORM_MYSQL_PING
+using Orm::Constants::QMYSQL;
+#endif
+
+namespace Orm::Support
+{
+
+/* public */
+
+ConnectionLease::ConnectionLease(std::shared_ptr<ConnectionPool> pool,
+                                 DatabaseConnection &connection)
+    : m_connection(&connection)
+{
+    // Nested lease, the current thread already holds a physical connection
+    if (connection.usingPooledQtConnection())
+        return;
+
+    m_pool = std::move(pool);
+
+    acquire();
+}
+
+ConnectionLease::~ConnectionLease()
+{
+    release();
+}
+
+ConnectionLease::ConnectionLease(ConnectionLease &&other) noexcept
+    : m_pool(std::move(other.m_pool))
+    , m_connection(other.m_connection)
+    , m_qtConnection(std::move(other.m_qtConnection))
+{}
+
+ConnectionLease &ConnectionLease::operator=(ConnectionLease &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    release();
+
+    m_pool = std::move(other.m_pool);
+    m_connection = other.m_connection;
+    m_qtConnection = std::move(other.m_qtConnection);
+
+    return *this;
+}
+
+void ConnectionLease::release()
+{
+    // Nothing to release
+    if (!m_pool)
+        return;
+
+    const auto pool = std::move(m_pool);
+    auto broken = false;
+
+    // A transaction can't outlive the lease, the next thread would continue it
+    if (m_connection->inTransaction())
+        try {
+            m_connection->rollBack();
+
+        } catch (...) {
+            broken = true;
+        }
+
+    m_connection->releasePooledQtConnection();
+
+    if (broken)
+        pool->discard(m_qtConnection);
+    else
+        pool->release(m_qtConnection);
+}
+
+/* private */
+
+void ConnectionLease::acquire()
+{
+    while (true) {
+        auto [qtConnection, shouldPing] = m_pool->acquire();
+
+        m_connection->usePooledQtConnection(qtConnection,
+                                            m_pool->reopenResolver(qtConnection));
+
+        // Freshly opened or recently released connections are considered healthy
+        if (!shouldPing || isHealthy()) {
+            m_qtConnection = std::move(qtConnection);
+            return;
+        }
+
+        // Close the broken connection and try the next one
+        m_connection->releasePooledQtConnection();
+        m_pool->discard(qtConnection, true);
+    }
+}
+
+bool ConnectionLease::isHealthy() const
+{
+    try {
+#ifdef TINYORM_MYSQL_PING
+        if (m_connection->driverName() == QMYSQL)
+            return m_connection->pingDatabase();
+#endif
+
+        /* Don't use the DatabaseConnection::select() as it would silently reconnect
+           and the query would be logged and counted. */
+        QSqlQuery query(m_connection->getRawQtConnection());
+
+        return query.exec(QStringLiteral("select 1"));
+
+    } catch (...) {
+        return false;
+    }
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,411 @@
+#include "orm/support/connectionpool.hpp"
+
+#include <QThread>
+
+#include "orm/connectors/connectionfactory.hpp"
+#include "orm/constants.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/utils/type.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::NAME;
+using Orm::Constants::pool_;
+
+using Orm::Connectors::ConnectionName;
+
+namespace Orm::Support
+{
+
+namespace
+{
+    /*! The minimum number of physical connections kept open. */
+    const auto MinOption = QStringLiteral("min");
+    /*! The maximum number of physical connections. */
+    const auto MaxOption = QStringLiteral("max");
+    /*! The maximum time in milliseconds to wait for a released connection. */
+    const auto AcquireTimeoutOption = QStringLiteral("acquire_timeout");
+    /*! Idle connections above the minimum are closed after this time (ms). */
+    const auto IdleTimeoutOption = QStringLiteral("idle_timeout");
+    /*! Idle connections are health-checked after this time (ms). */
+    const auto PingIntervalOption = QStringLiteral("ping_interval");
+
+    /*! Change the thread affinity of the given QSqlDatabase connection. */
+    bool moveToThread(QSqlDatabase &database, QThread *const thread)
+    {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 8, 0)
+        return database.moveToThread(thread);
+#else
+        Q_UNUSED(database)
+        Q_UNUSED(thread)
+
+        return false;
+#endif
+    }
+
+    /*! Convert the duration to milliseconds. */
+    qint64 toMilliseconds(const std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    }
+} // namespace
+
+/* public */
+
+ConnectionPool::ConnectionPool(QString connection, QVariantHash config)
+    : m_connection(std::move(connection))
+    , m_config(std::move(config))
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 8, 0)
+    throw Exceptions::LogicError(
+                QStringLiteral(
+                    "The connection pool for the '%1' connection requires Qt >=6.8 "
+                    "because it uses the QSqlDatabase::moveToThread(), in %2().")
+                .arg(m_connection, __tiny_func__));
+#endif
+
+    parseConfiguration();
+
+    m_stats.maxSize = static_cast<qint64>(m_maxSize);
+}
+
+ConnectionPool::~ConnectionPool()
+{
+    std::vector<IdleConnection> idle;
+
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        idle.swap(m_idle);
+    }
+
+    closeIdleConnections(std::move(idle));
+}
+
+ConnectionPool::AcquiredConnection ConnectionPool::acquire()
+{
+    const auto waitStart = Clock::now();
+    const auto deadline = waitStart + m_acquireTimeout;
+    auto waited = false;
+
+    std::unique_lock lock(m_mutex);
+
+    while (true) {
+        // Reuse the most recently released connection, stale connections sink down
+        if (!m_idle.empty()) {
+            auto idle = std::move(m_idle.back());
+            m_idle.pop_back();
+
+            // Pull the connection without a thread affinity to the current thread
+            if (!moveToThread(idle.database, QThread::currentThread())) {
+                ++m_stats.closed;
+                lock.unlock();
+                closeConnection(idle.name, std::move(idle.database));
+                lock.lock();
+                continue;
+            }
+
+            const auto shouldPing = Clock::now() - idle.idleSince >= m_pingInterval;
+
+            m_leased.emplace(idle.name, std::move(idle.database));
+            recordWaitTime(waitStart, waited);
+
+            return {std::move(idle.name), shouldPing};
+        }
+
+        // Open a new physical connection, it's opened outside of the lock
+        if (sizeInternal() < m_maxSize) {
+            auto qtConnection = QStringLiteral("%1-pool-%2").arg(m_connection)
+                                                            .arg(++m_nextId);
+            ++m_opening;
+            lock.unlock();
+
+            QSqlDatabase database;
+            try {
+                database = openConnection(qtConnection);
+
+            } catch (...) {
+                lock.lock();
+                --m_opening;
+                lock.unlock();
+
+                // Give a chance to another waiting thread
+                m_released.notify_one();
+
+                if (QSqlDatabase::contains(qtConnection))
+                    QSqlDatabase::removeDatabase(qtConnection);
+
+                throw;
+            }
+
+            lock.lock();
+            --m_opening;
+            ++m_stats.opened;
+
+            m_leased.emplace(qtConnection, std::move(database));
+            recordWaitTime(waitStart, waited);
+
+            return {std::move(qtConnection), false};
+        }
+
+        // The pool is full, wait for a released connection
+        waited = true;
+
+        if (m_released.wait_until(lock, deadline, [this]
+        {
+            return !m_idle.empty() || sizeInternal() < m_maxSize;
+        }))
+            continue;
+
+        ++m_stats.timeouts;
+
+        throw Exceptions::RuntimeError(
+                    QStringLiteral(
+                        "Timed out after %1ms waiting for a physical connection from "
+                        "the '%2' connection pool (%3 connections leased), in %4().")
+                    .arg(m_acquireTimeout.count()).arg(m_connection)
+                    .arg(m_leased.size()).arg(__tiny_func__));
+    }
+}
+
+void ConnectionPool::release(const ConnectionName &qtConnection)
+{
+    // Stays counted as leased until it's idle so the pool can't overflow
+    QSqlDatabase database;
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        const auto itLeased = m_leased.find(qtConnection);
+        if (itLeased == m_leased.end())
+            return;
+
+        database = itLeased->second;
+    }
+
+    /* Push the connection out of the current thread so any thread can pull it, it
+       fails if some QSqlQuery is still bound to the connection, such a connection
+       can't be shared so it's closed. */
+    if (!database.isOpen() || !moveToThread(database, nullptr)) {
+        // All QSqlDatabase copies have to be destroyed before the removeDatabase()
+        database = QSqlDatabase();
+
+        discard(qtConnection);
+        return;
+    }
+
+    std::vector<IdleConnection> expired;
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        m_leased.erase(qtConnection);
+        m_idle.push_back({qtConnection, std::move(database), Clock::now()});
+
+        expired = takeExpiredIdle();
+    }
+
+    m_released.notify_all();
+
+    closeIdleConnections(std::move(expired));
+}
+
+void ConnectionPool::discard(const ConnectionName &qtConnection,
+                             const bool failedHealthCheck)
+{
+    QSqlDatabase database;
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        const auto itLeased = m_leased.find(qtConnection);
+        if (itLeased == m_leased.end())
+            return;
+
+        database = std::move(itLeased->second);
+        m_leased.erase(itLeased);
+
+        ++m_stats.closed;
+
+        if (failedHealthCheck)
+            ++m_stats.failedHealthChecks;
+    }
+
+    m_released.notify_one();
+
+    closeConnection(qtConnection, std::move(database));
+}
+
+std::size_t ConnectionPool::evictIdle()
+{
+    std::vector<IdleConnection> expired;
+    {
+        const std::scoped_lock lock(m_mutex);
+
+        expired = takeExpiredIdle();
+    }
+
+    const auto evicted = expired.size();
+
+    if (evicted > 0)
+        m_released.notify_all();
+
+    closeIdleConnections(std::move(expired));
+
+    return evicted;
+}
+
+ConnectionPoolStats ConnectionPool::stats() const
+{
+    const std::scoped_lock lock(m_mutex);
+
+    auto stats = m_stats;
+
+    stats.size   = static_cast<qint64>(sizeInternal());
+    stats.leased = static_cast<qint64>(m_leased.size());
+    stats.idle   = static_cast<qint64>(m_idle.size());
+
+    stats.utilization = static_cast<double>(stats.leased) /
+                        static_cast<double>(stats.maxSize);
+
+    return stats;
+}
+
+std::function<ConnectionName()>
+ConnectionPool::reopenResolver(const ConnectionName &qtConnection) const
+{
+    auto config = m_config;
+    config.insert(NAME, qtConnection);
+
+    /* The connector reuses the existing QSqlDatabase connection with the same name,
+       so the physical connection is reopened and the session is configured again
+       (charset, time zone, isolation level, pragmas, ...). */
+    return Connectors::ConnectionFactory::createQSqlDatabaseResolver(config);
+}
+
+std::function<ConnectionName()>
+ConnectionPool::unleasedResolver(const QString &connection)
+{
+    return [connection]() -> ConnectionName
+    {
+        throw Exceptions::LogicError(
+                    QStringLiteral(
+                        "The '%1' connection is pooled, lease a physical connection "
+                        "using the DB::lease() method before querying the database.")
+                    .arg(connection));
+    };
+}
+
+/* private */
+
+void ConnectionPool::parseConfiguration()
+{
+    const auto pool = m_config.value(pool_).value<QVariantHash>();
+
+    const auto nonNegative = [this, &pool](const QString &option,
+                                           const qint64 defaultValue)
+    {
+        if (!pool.contains(option))
+            return defaultValue;
+
+        auto ok = false;
+        const auto value = pool.value(option).toLongLong(&ok);
+
+        if (ok && value >= 0)
+            return value;
+
+        throw Exceptions::InvalidArgumentError(
+                    QStringLiteral(
+                        "The '%1' connection pool option must be a non-negative "
+                        "integer in the '%2' connection configuration.")
+                    .arg(option, m_connection));
+    };
+
+    m_minSize = static_cast<std::size_t>(nonNegative(MinOption, 0));
+    m_maxSize = static_cast<std::size_t>(
+                    nonNegative(MaxOption, static_cast<qint64>(m_maxSize)));
+
+    m_acquireTimeout = std::chrono::milliseconds(
+                           nonNegative(AcquireTimeoutOption, m_acquireTimeout.count()));
+    m_idleTimeout    = std::chrono::milliseconds(
+                           nonNegative(IdleTimeoutOption, m_idleTimeout.count()));
+    m_pingInterval   = std::chrono::milliseconds(
+                           nonNegative(PingIntervalOption, m_pingInterval.count()));
+
+    if (m_maxSize > 0 && m_minSize <= m_maxSize)
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral(
+                    "The 'max' connection pool option must be greater than 0 and "
+                    "greater or equal to the 'min' option in the '%1' connection "
+                    "configuration, in %2().")
+                .arg(m_connection, __tiny_func__));
+}
+
+std::vector<ConnectionPool::IdleConnection> ConnectionPool::takeExpiredIdle()
+{
+    std::vector<IdleConnection> expired;
+
+    const auto now = Clock::now();
+
+    // The least recently released connections are at the front
+    auto itIdle = m_idle.begin();
+
+    while (itIdle != m_idle.end() && sizeInternal() - expired.size() > m_minSize &&
+           now - itIdle->idleSince >= m_idleTimeout
+    )
+        expired.push_back(std::move(*itIdle++));
+
+    m_idle.erase(m_idle.begin(), itIdle);
+
+    m_stats.evicted += static_cast<qint64>(expired.size());
+    m_stats.closed  += static_cast<qint64>(expired.size());
+
+    return expired;
+}
+
+QSqlDatabase ConnectionPool::openConnection(const ConnectionName &qtConnection) const
+{
+    // Opens the physical connection and configures the session
+    const auto qtConnectionName = std::invoke(reopenResolver(qtConnection));
+
+    return QSqlDatabase::database(qtConnectionName, false);
+}
+
+void ConnectionPool::closeConnection(const ConnectionName &qtConnection,
+                                     QSqlDatabase &&database)
+{
+    // Idle connections don't have a thread affinity, pull it to the current thread
+    moveToThread(database, QThread::currentThread());
+
+    database.close();
+    // All QSqlDatabase copies have to be destroyed before the removeDatabase()
+    database = QSqlDatabase();
+
+    QSqlDatabase::removeDatabase(qtConnection);
+}
+
+void ConnectionPool::closeIdleConnections(std::vector<IdleConnection> &&connections)
+{
+    for (auto &connection : connections)
+        closeConnection(connection.name, std::move(connection.database));
+}
+
+void ConnectionPool::recordWaitTime(const Clock::time_point waitStart,
+                                    const bool waited)
+{
+    ++m_stats.acquired;
+
+    if (!waited)
+        return;
+
+    const auto waitTime = toMilliseconds(Clock::now() - waitStart);
+
+    ++m_stats.waited;
+    m_stats.waitTime += waitTime;
+    m_stats.maxWaitTime = std::max(m_stats.maxWaitTime, waitTime);
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
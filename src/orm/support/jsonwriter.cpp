@@ -0,0 +1,386 @@
+#include "orm/support/jsonwriter.hpp"
+
+#include <QIODevice>
+#include <QJsonValue>
+#include <QLocale>
+#include <QUrl>
+#include <QUuid>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+#include "orm/utils/helpers.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Utils::Helpers;
+
+namespace Orm::Support
+{
+
+/* public */
+
+JsonWriter::JsonWriter(QByteArray &buffer, const QJsonDocument::JsonFormat format)
+    : m_buffer(buffer)
+    , m_indented(format == QJsonDocument::Indented)
+{}
+
+JsonWriter::JsonWriter(QIODevice &device, const QJsonDocument::JsonFormat format)
+    : m_buffer(m_deviceBuffer)
+    , m_device(&device)
+    , m_indented(format == QJsonDocument::Indented)
+{
+    // Leave some space for the value that crosses the threshold
+    m_deviceBuffer.reserve(FlushThreshold * 2);
+}
+
+JsonWriter::~JsonWriter()
+{
+    flush();
+}
+
+void JsonWriter::beginObject()
+{
+    prepareValue();
+
+    m_buffer.append('{');
+    m_first.push_back(true);
+}
+
+void JsonWriter::endObject()
+{
+    Q_ASSERT(!m_first.empty());
+
+    m_first.pop_back();
+
+    writeIndentation();
+    m_buffer.append('}');
+
+    // The same as the QJsonDocument::toJson(), the indented document ends with newline
+    if (m_indented && m_first.empty())
+        m_buffer.append('\n');
+}
+
+void JsonWriter::beginArray()
+{
+    prepareValue();
+
+    m_buffer.append('[');
+    m_first.push_back(true);
+}
+
+void JsonWriter::endArray()
+{
+    Q_ASSERT(!m_first.empty());
+
+    m_first.pop_back();
+
+    writeIndentation();
+    m_buffer.append(']');
+
+    // The same as the QJsonDocument::toJson(), the indented document ends with newline
+    if (m_indented && m_first.empty())
+        m_buffer.append('\n');
+}
+
+void JsonWriter::writeKey(const QString &key)
+{
+    Q_ASSERT(!m_afterKey);
+
+    prepareValue();
+
+    writeString(key);
+
+    if (m_indented)
+        writeRaw(": ", 2);
+    else
+        m_buffer.append(':');
+
+    m_afterKey = true;
+}
+
+void JsonWriter::writeValue(const QVariant &value) // NOLINT(misc-no-recursion)
+{
+    // The same as the AttributeUtils::fixQtNullVariantBug(), the null QVariant is null
+    if (value.isNull())
+        return writeNull(); // NOLINT(readability-avoid-return-with-void-value)
+
+    switch (Helpers::qVariantTypeId(value)) {
+    case QMetaType::Bool:
+        prepareValue();
+
+        if (value.toBool())
+            writeRaw("true", 4);
+        else
+            writeRaw("false", 5);
+        break;
+
+    case QMetaType::Short:
+    case QMetaType::Int:
+    case QMetaType::Long:
+    case QMetaType::LongLong:
+        prepareValue();
+        writeInteger(value.toLongLong());
+        break;
+
+    case QMetaType::UShort:
+    case QMetaType::UInt:
+    case QMetaType::ULong:
+    case QMetaType::ULongLong:
+        prepareValue();
+        writeUnsignedInteger(value.toULongLong());
+        break;
+
+    case QMetaType::Float:
+    case QMetaType::Double:
+        prepareValue();
+        writeDouble(value.toDouble());
+        break;
+
+    case QMetaType::QString:
+        prepareValue();
+        writeString(value.toString());
+        break;
+
+    case QMetaType::QByteArray:
+        prepareValue();
+        writeString(QString::fromUtf8(value.toByteArray()));
+        break;
+
+    case QMetaType::QStringList:
+        beginArray();
+        for (const auto &string : value.toStringList()) {
+            prepareValue();
+            writeString(string);
+        }
+        endArray();
+        break;
+
+    case QMetaType::QVariantList:
+        beginArray();
+        for (const auto &item : value.toList())
+            writeValue(item);
+        endArray();
+        break;
+
+    case QMetaType::QVariantMap:
+    {
+        beginObject();
+        const auto map = value.toMap();
+        for (auto it = map.constBegin(); it != map.constEnd(); ++it) {
+            writeKey(it.key());
+            writeValue(it.value());
+        }
+        endObject();
+    }
+        break;
+
+    case QMetaType::QVariantHash:
+    {
+        beginObject();
+        const auto hash = value.toHash();
+        for (auto it = hash.constBegin(); it != hash.constEnd(); ++it) {
+            writeKey(it.key());
+            writeValue(it.value());
+        }
+        endObject();
+    }
+        break;
+
+    // The same as the QJsonValue::fromVariant()
+    case QMetaType::QUuid:
+        prepareValue();
+        writeString(value.toUuid().toString(QUuid::WithoutBraces));
+        break;
+
+    case QMetaType::QUrl:
+        prepareValue();
+        writeString(value.toUrl().toString(QUrl::FullyEncoded));
+        break;
+
+    case QMetaType::QJsonValue:
+    case QMetaType::QJsonObject:
+    case QMetaType::QJsonArray:
+        writeValue(QJsonValue::fromVariant(value).toVariant());
+        break;
+
+    /* The same as the QJsonValue::fromVariant(), all other types are converted
+       to the QString, the empty string is null. */
+    default:
+    {
+        const auto string = value.toString();
+
+        if (string.isEmpty())
+            writeNull();
+        else {
+            prepareValue();
+            writeString(string);
+        }
+    }
+        break;
+    }
+}
+
+void JsonWriter::writeNull()
+{
+    prepareValue();
+
+    writeRaw("null", 4);
+}
+
+bool JsonWriter::flush()
+{
+    // Nothing to do, the QByteArray sink
+    if (m_device == nullptr || m_buffer.isEmpty())
+        return !m_failed;
+
+    if (m_device->write(m_buffer) != m_buffer.size())
+        m_failed = true;
+
+    // Keep the capacity, the buffer is reused
+    m_buffer.resize(0);
+
+    return !m_failed;
+}
+
+/* private */
+
+void JsonWriter::prepareValue()
+{
+    // Nothing to do, the object member value follows its key
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+
+    flushIfFull();
+
+    // Nothing to do, the top-level value
+    if (m_first.empty())
+        return;
+
+    if (m_first.back())
+        m_first.back() = false;
+    else
+        m_buffer.append(',');
+
+    writeIndentation();
+}
+
+void JsonWriter::writeIndentation()
+{
+    if (!m_indented)
+        return;
+
+    m_buffer.append('\n');
+
+    for (std::size_t level = 0; level < m_first.size(); ++level)
+        writeRaw("    ", 4);
+}
+
+void JsonWriter::writeString(const QString &string)
+{
+    static constexpr const char *Hex = "0123456789abcdef";
+
+    m_buffer.append('"');
+
+    // Encode the UTF-16 to the UTF-8 directly, the QString::toUtf8() allocates
+    const auto *it = string.constData();
+    const auto *const end = it + string.size();
+
+    for (; it != end; ++it) {
+        const auto ch = it->unicode();
+
+        if (ch < 0x80) {
+            switch (ch) {
+            case u'"':
+                writeRaw("\\\"", 2);
+                break;
+            case u'\\':
+                writeRaw("\\\\", 2);
+                break;
+            case u'\b':
+                writeRaw("\\b", 2);
+                break;
+            case u'\f':
+                writeRaw("\\f", 2);
+                break;
+            case u'\n':
+                writeRaw("\\n", 2);
+                break;
+            case u'\r':
+                writeRaw("\\r", 2);
+                break;
+            case u'\t':
+                writeRaw("\\t", 2);
+                break;
+            default:
+                if (ch < 0x20) {
+                    const std::array<char, 6> escaped {
+                        '\\', 'u', '0', '0', Hex[ch >> 4], Hex[ch & 0xF]
+                    };
+                    writeRaw(escaped.data(), escaped.size());
+                }
+                else
+                    m_buffer.append(static_cast<char>(ch));
+            }
+        }
+        else if (ch < 0x800) {
+            m_buffer.append(static_cast<char>(0xC0 | (ch >> 6)));
+            m_buffer.append(static_cast<char>(0x80 | (ch & 0x3F)));
+        }
+        else if (QChar::isHighSurrogate(ch) && it + 1 != end &&
+                 (it + 1)->isLowSurrogate()
+        ) {
+            const auto ucs4 = QChar::surrogateToUcs4(ch, (++it)->unicode());
+
+            m_buffer.append(static_cast<char>(0xF0 | (ucs4 >> 18)));
+            m_buffer.append(static_cast<char>(0x80 | ((ucs4 >> 12) & 0x3F)));
+            m_buffer.append(static_cast<char>(0x80 | ((ucs4 >> 6) & 0x3F)));
+            m_buffer.append(static_cast<char>(0x80 | (ucs4 & 0x3F)));
+        }
+        // Unpaired surrogate, the same as the QString::toUtf8() (replacement character)
+        else if (QChar::isSurrogate(ch))
+            writeRaw("\xEF\xBF\xBD", 3);
+
+        else {
+            m_buffer.append(static_cast<char>(0xE0 | (ch >> 12)));
+            m_buffer.append(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+            m_buffer.append(static_cast<char>(0x80 | (ch & 0x3F)));
+        }
+    }
+
+    m_buffer.append('"');
+}
+
+void JsonWriter::writeInteger(const qint64 value)
+{
+    std::array<char, 24> number {};
+    const auto result = std::to_chars(number.data(), number.data() + number.size(),
+                                      value);
+
+    writeRaw(number.data(), result.ptr - number.data());
+}
+
+void JsonWriter::writeUnsignedInteger(const quint64 value)
+{
+    std::array<char, 24> number {};
+    const auto result = std::to_chars(number.data(), number.data() + number.size(),
+                                      value);
+
+    writeRaw(number.data(), result.ptr - number.data());
+}
+
+void JsonWriter::writeDouble(const double value)
+{
+    // The same as the QJsonDocument::toJson(), the NaN and infinity are null
+    if (!std::isfinite(value))
+        return writeRaw("null", 4); // NOLINT(readability-avoid-return-with-void-value)
+
+    m_buffer.append(QByteArray::number(value, 'g', QLocale::FloatingPointShortest));
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
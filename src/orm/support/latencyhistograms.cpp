@@ -0,0 +1,184 @@
+#include "orm/support/latencyhistograms.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "orm/utils/query.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using QueryUtils = Orm::Utils::Query;
+
+namespace Orm::Support
+{
+
+/* public */
+
+void LatencyHistograms::record(const QString &queryString, const StatementType type,
+                               const qint64 nsecs)
+{
+    Q_ASSERT_X(m_threadId == std::this_thread::get_id(),
+               "LatencyHistograms::record",
+               "The connection can be used only from the thread that created it.");
+
+    auto &histogram = this->histogram(queryString, type);
+
+    const auto usecs = nsecs / 1000;
+
+    ++histogram.buckets.at(bucketIndex(usecs));
+    ++histogram.count;
+    histogram.totalTime += usecs;
+    histogram.maxTime = std::max(histogram.maxTime, usecs);
+}
+
+std::vector<StatementLatency> LatencyHistograms::statements() const
+{
+    std::vector<StatementLatency> statements;
+    statements.reserve(m_histograms.size());
+
+    for (const auto &[key, histogram] : m_histograms) {
+        StatementLatency statement {
+            key.mid(1),
+            static_cast<StatementType>(key.at(0).unicode() - u'0'),
+            histogram.count, histogram.totalTime, histogram.maxTime, 0, 0, 0,
+            std::vector<qint64>(histogram.buckets.cbegin(), histogram.buckets.cend())
+        };
+
+        computePercentiles(statement);
+
+        statements.push_back(std::move(statement));
+    }
+
+    sortByTotalTime(statements);
+
+    return statements;
+}
+
+void LatencyHistograms::clear()
+{
+    for (auto &queries : m_queries)
+        queries.clear();
+
+    m_histograms.clear();
+}
+
+std::vector<StatementLatency>
+LatencyHistograms::merge(std::vector<StatementLatency> &&statements)
+{
+    std::unordered_map<KeyType, StatementLatency> merged;
+    merged.reserve(statements.size());
+
+    for (auto &statement : statements) {
+        auto [itMerged, inserted] = merged.try_emplace(
+                                        histogramKey(statement.fingerprint,
+                                                     statement.type));
+        auto &mergedStatement = itMerged->second;
+
+        if (inserted) {
+            mergedStatement = std::move(statement);
+            continue;
+        }
+
+        mergedStatement.count     += statement.count;
+        mergedStatement.totalTime += statement.totalTime;
+        mergedStatement.maxTime    = std::max(mergedStatement.maxTime,
+                                              statement.maxTime);
+
+        for (std::size_t bucket = 0; bucket < mergedStatement.buckets.size() &&
+                                     bucket < statement.buckets.size(); ++bucket)
+            mergedStatement.buckets[bucket] += statement.buckets[bucket];
+    }
+
+    std::vector<StatementLatency> result;
+    result.reserve(merged.size());
+
+    for (auto &&[key, statement] : merged) {
+        computePercentiles(statement);
+
+        result.push_back(std::move(statement));
+    }
+
+    sortByTotalTime(result);
+
+    return result;
+}
+
+/* private */
+
+LatencyHistograms::Histogram &
+LatencyHistograms::histogram(const QString &queryString, const StatementType type)
+{
+    auto &queries = m_queries.at(static_cast<std::size_t>(type));
+
+    // Fast path, the raw SQL query was already normalized
+    if (const auto itQuery = queries.find(queryString); itQuery != queries.end())
+        return *itQuery->second;
+
+    // Unprepared queries with different literals could grow the cache without limit
+    if (queries.size() >= MaxQueriesCount)
+        queries.clear();
+
+    // Histograms are node-based so the pointer stays valid
+    auto &histogram =
+            m_histograms[histogramKey(QueryUtils::fingerprint(queryString), type)];
+
+    queries.emplace(queryString, &histogram);
+
+    return histogram;
+}
+
+LatencyHistograms::KeyType
+LatencyHistograms::histogramKey(const QString &fingerprint, const StatementType type)
+{
+    return QChar(static_cast<char16_t>(u'0' + static_cast<quint8>(type))) +
+           fingerprint;
+}
+
+std::size_t LatencyHistograms::bucketIndex(const qint64 usecs) noexcept
+{
+    if (usecs <= 0)
+        return 0;
+
+    return std::min<std::size_t>(std::bit_width(static_cast<quint64>(usecs)),
+                                 BucketsCount - 1);
+}
+
+void LatencyHistograms::computePercentiles(StatementLatency &statement)
+{
+    if (statement.count <= 0)
+        return;
+
+    const auto percentile = [&statement](const qint64 percent)
+    {
+        // Rank of the statement at the given percentile (rounded up)
+        const auto rank = (statement.count * percent + 99) / 100;
+        qint64 seen = 0;
+
+        for (std::size_t bucket = 0; bucket < statement.buckets.size(); ++bucket) {
+            seen += statement.buckets[bucket];
+
+            if (seen >= rank)
+                // The upper bound of the bucket can't be higher than the max. time
+                return std::min(qint64(1) << bucket, statement.maxTime);
+        }
+
+        return statement.maxTime;
+    };
+
+    statement.p50 = percentile(50);
+    statement.p90 = percentile(90);
+    statement.p99 = percentile(99);
+}
+
+void LatencyHistograms::sortByTotalTime(std::vector<StatementLatency> &statements)
+{
+    std::ranges::sort(statements, [](const StatementLatency &left,
+                                     const StatementLatency &right)
+    {
+        return left.totalTime > right.totalTime;
+    });
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
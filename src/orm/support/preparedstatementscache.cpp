@@ -0,0 +1,118 @@
+#include "orm/support/preparedstatementscache.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/* public */
+
+PreparedStatementsCache::PreparedStatementsCache(const size_type capacity)
+    : m_capacity(capacity)
+{
+    m_index.reserve(capacity);
+}
+
+std::optional<QSqlQuery>
+PreparedStatementsCache::get(const QString &queryString, const bool forwardOnly)
+{
+    const auto itIndex = m_index.find(queryString);
+
+    if (itIndex == m_index.end())
+        return std::nullopt;
+
+    auto &query = itIndex->second->second;
+
+    /* The forward-only mode can't be changed on the prepared query, it must be set
+       before prepare, so the caller has to prepare a new query. */
+    if (query.isForwardOnly() != forwardOnly)
+        return std::nullopt;
+
+    /* The QSqlQuery copy shares the same QSqlResult, re-executing the select query
+       whose result is still active would clobber the result set the previous caller
+       can still iterate (eg. the same query inside the while (query.next()) loop),
+       so it's in use and the caller has to prepare a new query. The result that was
+       traversed to the end can't be read anymore, so it's released and re-used.
+       Other statements don't have any result set to iterate. */
+    if (query.isActive() && query.isSelect()) {
+        if (query.at() != QSql::AfterLastRow)
+            return std::nullopt;
+
+        query.finish();
+    }
+
+    // Mark as the most recently used
+    m_queries.splice(m_queries.begin(), m_queries, itIndex->second);
+
+    /* The cached query will be re-bound and re-executed, the database will not parse
+       the query again. */
+    return query;
+}
+
+bool PreparedStatementsCache::insert(const QString &queryString, const QSqlQuery &query)
+{
+    // Nothing to cache
+    if (m_capacity == 0)
+        return false;
+
+    // Replace the already cached query
+    if (const auto itIndex = m_index.find(queryString);
+        itIndex != m_index.end()
+    ) {
+        itIndex->second->second = query;
+
+        m_queries.splice(m_queries.begin(), m_queries, itIndex->second);
+
+        return false;
+    }
+
+    m_queries.emplace_front(queryString, query);
+    m_index.emplace(queryString, m_queries.begin());
+
+    return evictOverCapacity() > 0;
+}
+
+void PreparedStatementsCache::remove(const QString &queryString)
+{
+    const auto itIndex = m_index.find(queryString);
+
+    if (itIndex == m_index.end())
+        return;
+
+    m_queries.erase(itIndex->second);
+    m_index.erase(itIndex);
+}
+
+void PreparedStatementsCache::clear()
+{
+    m_index.clear();
+    m_queries.clear();
+}
+
+PreparedStatementsCache::size_type
+PreparedStatementsCache::setCapacity(const size_type capacity)
+{
+    m_capacity = capacity;
+
+    return evictOverCapacity();
+}
+
+/* private */
+
+PreparedStatementsCache::size_type PreparedStatementsCache::evictOverCapacity()
+{
+    size_type evicted = 0;
+
+    while (m_queries.size() > m_capacity) {
+        m_index.erase(m_queries.back().first);
+        m_queries.pop_back();
+
+        ++evicted;
+    }
+
+    return evicted;
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
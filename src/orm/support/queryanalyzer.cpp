@@ -0,0 +1,118 @@
+#include "orm/support/queryanalyzer.hpp"
+
+#include "orm/utils/query.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using QueryUtils = Orm::Utils::Query;
+
+namespace Orm::Support
+{
+
+/* public */
+
+QueryAnalyzer::QueryAnalyzer(CallbackType &&callback, const qint64 slowQueryThreshold,
+                             const qint64 nPlusOneThreshold)
+    : m_callback(std::move(callback))
+    , m_slowQueryThreshold(slowQueryThreshold)
+    , m_nPlusOneThreshold(nPlusOneThreshold)
+{}
+
+void QueryAnalyzer::analyze(
+        const QString &connection, const QString &queryString,
+        const QVector<QVariant> &bindings, const StatementType type,
+        const qint64 nsecs)
+{
+    // The N+1 detection caches the fingerprint of the last query, so it goes first
+    detectNPlusOne(connection, queryString, bindings, type, nsecs);
+
+    detectSlowQuery(connection, queryString, bindings, nsecs);
+}
+
+void QueryAnalyzer::reset()
+{
+    m_lastQuery.clear();
+    m_lastFingerprint.clear();
+    m_lastBindings.clear();
+    m_repeated = 0;
+    m_repeatedTime = 0;
+}
+
+/* private */
+
+void QueryAnalyzer::detectSlowQuery(
+        const QString &connection, const QString &queryString,
+        const QVector<QVariant> &bindings, const qint64 nsecs)
+{
+    if (m_slowQueryThreshold <= 0)
+        return;
+
+    const auto elapsed = toMilliseconds(nsecs);
+
+    if (elapsed < m_slowQueryThreshold)
+        return;
+
+    std::invoke(m_callback, QueryIssue {QueryIssue::Type::SLOW_QUERY, connection,
+                                        queryString, fingerprint(queryString),
+                                        bindings, elapsed, 1});
+}
+
+void QueryAnalyzer::detectNPlusOne(
+        const QString &connection, const QString &queryString,
+        const QVector<QVariant> &bindings, const StatementType type,
+        const qint64 nsecs)
+{
+    // Only select queries are loading models, other statements don't break the row
+    if (m_nPlusOneThreshold <= 0 || type != StatementType::Select)
+        return;
+
+    /* The same query string is the common case (prepared statements with different
+       bindings), the fingerprint has to be computed for a different query only. */
+    if (queryString != m_lastQuery) {
+        auto fingerprint = QueryUtils::fingerprint(queryString);
+        const auto sameShape = fingerprint == m_lastFingerprint;
+
+        m_lastQuery = queryString;
+        m_lastFingerprint = std::move(fingerprint);
+
+        if (!sameShape) {
+            startRepeating(bindings, nsecs);
+            return;
+        }
+    }
+
+    // The same query with the same bindings isn't loading different models
+    if (bindings == m_lastBindings)
+        return;
+
+    m_lastBindings = bindings;
+    m_repeatedTime += nsecs;
+
+    // Report every repeated query only once
+    if (++m_repeated != m_nPlusOneThreshold)
+        return;
+
+    std::invoke(m_callback, QueryIssue {QueryIssue::Type::N_PLUS_ONE, connection,
+                                        queryString, m_lastFingerprint, bindings,
+                                        toMilliseconds(m_repeatedTime), m_repeated});
+}
+
+void QueryAnalyzer::startRepeating(const QVector<QVariant> &bindings,
+                                   const qint64 nsecs)
+{
+    m_lastBindings = bindings;
+    m_repeated = 1;
+    m_repeatedTime = nsecs;
+}
+
+QString QueryAnalyzer::fingerprint(const QString &queryString) const
+{
+    if (queryString == m_lastQuery)
+        return m_lastFingerprint;
+
+    return QueryUtils::fingerprint(queryString);
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
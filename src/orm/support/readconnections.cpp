@@ -0,0 +1,102 @@
+#include "orm/support/readconnections.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/* public */
+
+ReadConnections::ReadConnections(std::vector<ResolverType> &&resolvers,
+                                 QStringList &&qtConnectionNames,
+                                 const Strategy strategy)
+    : m_qtConnectionNames(std::move(qtConnectionNames))
+    , m_strategy(strategy)
+{
+    Q_ASSERT(resolvers.size() == static_cast<std::size_t>(m_qtConnectionNames.size()));
+
+    m_connections.reserve(resolvers.size());
+
+    for (auto &resolver : resolvers)
+        m_connections.push_back({std::move(resolver)});
+}
+
+std::size_t ReadConnections::next()
+{
+    Q_ASSERT(!m_connections.empty());
+
+    ++m_picks;
+
+    if (m_strategy == Strategy::LeastLatency && m_picks % ProbeInterval != 0)
+        return nextLeastLatency();
+
+    return nextRoundRobin();
+}
+
+QSqlDatabase ReadConnections::connection(const std::size_t index)
+{
+    auto &connection = m_connections.at(index);
+
+    // Connect lazily, the resolver opens the physical connection
+    if (!connection.qtConnection)
+        connection.qtConnection = std::invoke(connection.resolver);
+
+    // Reopens the connection if it was closed
+    return QSqlDatabase::database(*connection.qtConnection, true);
+}
+
+void ReadConnections::recordLatency(const std::size_t index, const qint64 nsecs)
+{
+    auto &averageLatency = m_connections.at(index).averageLatency;
+    const auto latency = static_cast<double>(nsecs);
+
+    if (averageLatency < 0)
+        averageLatency = latency;
+    else
+        averageLatency += LatencyWeight * (latency - averageLatency);
+}
+
+void ReadConnections::disconnect()
+{
+    for (auto &connection : m_connections) {
+        if (!connection.qtConnection)
+            continue;
+
+        QSqlDatabase::database(*connection.qtConnection, false).close();
+
+        connection.qtConnection.reset();
+    }
+}
+
+/* private */
+
+std::size_t ReadConnections::nextRoundRobin() noexcept
+{
+    const auto index = m_nextIndex;
+
+    m_nextIndex = (m_nextIndex + 1) % m_connections.size();
+
+    return index;
+}
+
+std::size_t ReadConnections::nextLeastLatency() noexcept
+{
+    std::size_t bestIndex = 0;
+
+    for (std::size_t index = 0; index < m_connections.size(); ++index) {
+        const auto latency = m_connections[index].averageLatency;
+
+        // Measure every read replica first
+        if (latency < 0)
+            return index;
+
+        if (latency < m_connections[bestIndex].averageLatency)
+            bestIndex = index;
+    }
+
+    return bestIndex;
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
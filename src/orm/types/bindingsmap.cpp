@@ -0,0 +1,122 @@
+#include "orm/types/bindingsmap.hpp"
+
+#include <algorithm>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Types
+{
+
+/* public */
+
+void BindingsMap::append(const BindingType type, const QVariant &binding)
+{
+    const auto oldSize = m_bindings.size();
+
+    m_bindings << binding;
+
+    finishAppend(type, oldSize);
+}
+
+void BindingsMap::append(const BindingType type, QVariant &&binding)
+{
+    const auto oldSize = m_bindings.size();
+
+    m_bindings << std::move(binding);
+
+    finishAppend(type, oldSize);
+}
+
+void BindingsMap::append(const BindingType type,
+                         const std::span<const QVariant> bindings)
+{
+    // Nothing to do
+    if (bindings.empty())
+        return;
+
+    const auto oldSize = m_bindings.size();
+
+    m_bindings.reserve(oldSize + static_cast<size_type>(bindings.size()));
+    std::ranges::copy(bindings, std::back_inserter(m_bindings));
+
+    finishAppend(type, oldSize);
+}
+
+void BindingsMap::append(const BindingType type, QVector<QVariant> &&bindings) // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
+{
+    // Nothing to do
+    if (bindings.isEmpty())
+        return;
+
+    const auto oldSize = m_bindings.size();
+
+    // Fast path, take the whole vector
+    if (oldSize == 0)
+        m_bindings = std::move(bindings);
+    else {
+        m_bindings.reserve(oldSize + bindings.size());
+        std::ranges::move(bindings, std::back_inserter(m_bindings));
+    }
+
+    finishAppend(type, oldSize);
+}
+
+void BindingsMap::set(const BindingType type, QVector<QVariant> &&bindings)
+{
+    clear(type);
+
+    append(type, std::move(bindings));
+}
+
+void BindingsMap::clear(const BindingType type)
+{
+    const auto count = size(type);
+
+    // Nothing to do
+    if (count == 0)
+        return;
+
+    /* The bindings are shared with the cloned query, copy only the remaining bindings
+       instead of detaching (copying) all of them and erasing them after. */
+    if (!m_bindings.isDetached()) {
+        const auto itBegin = m_bindings.constBegin() + beginOffset(type);
+
+        QVector<QVariant> bindings;
+        bindings.reserve(m_bindings.size() - count);
+
+        std::copy(m_bindings.constBegin(), itBegin, std::back_inserter(bindings));
+        std::copy(itBegin + count, m_bindings.constEnd(), std::back_inserter(bindings));
+
+        m_bindings = std::move(bindings);
+    }
+    else {
+        const auto itBegin = m_bindings.begin() + beginOffset(type);
+        m_bindings.erase(itBegin, itBegin + count);
+    }
+
+    for (auto offset = index(type) + 1; offset < m_offsets.size(); ++offset)
+        m_offsets[offset] -= count;
+}
+
+/* private */
+
+void BindingsMap::finishAppend(const BindingType type, const size_type oldSize)
+{
+    const auto count = m_bindings.size() - oldSize;
+    const auto position = endOffset(type);
+
+    /* Bindings are mostly added in the binding type order, so they are appended
+       to the last non-empty range and nothing has to be moved. */
+    if (position != oldSize) {
+        const auto itBegin = m_bindings.begin();
+
+        std::rotate(itBegin + position, itBegin + oldSize, m_bindings.end());
+    }
+
+    for (auto offset = index(type) + 1; offset < m_offsets.size(); ++offset)
+        m_offsets[offset] += count;
+}
+
+} // namespace Orm::Types
+
+TINYORM_END_COMMON_NAMESPACE
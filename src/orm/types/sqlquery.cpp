@@ -1,6 +1,7 @@
 #include "orm/types/sqlquery.hpp"
 
 #include <QtSql/QSqlDriver>
+#include <QtSql/QSqlField>
 
 #include "orm/query/grammars/grammar.hpp" // IWYU pragma: keep
 #include "orm/utils/helpers.hpp"
@@ -32,6 +33,22 @@ SqlQuery::SqlQuery(QSqlQuery &&other, const QtTimeZoneConfig &qtTimeZone, // NOL
     , m_returnQDateTime(returnQDateTime)
 {}
 
+QVector<SqlQuery::ValueConversion>
+SqlQuery::valueConversions(const QSqlRecord &record) const
+{
+    const auto fieldsCount = record.count();
+
+    QVector<ValueConversion> conversions;
+    conversions.reserve(fieldsCount);
+
+    for (auto i = 0; i < fieldsCount; ++i)
+        conversions << (canPrepareDateTime(fieldTypeId(record.field(i)))
+                        ? ValueConversion::DATETIME
+                        : ValueConversion::NONE);
+
+    return conversions;
+}
+
 /* private */
 
 QVariant SqlQuery::valueInternal(QVariant &&value) const
@@ -72,6 +89,31 @@ bool SqlQuery::shouldPrepareDateTime(const QVariant &value) const
              typeId == QMetaType::QString);
 }
 
+bool SqlQuery::canPrepareDateTime(const int typeId) const
+{
+    // Nothing to convert, no qt_timezone given in config.
+    if (!m_isConvertingTimeZone)
+        return false;
+
+    /* The QSQLITE driver reports column types by the declared type but SQLite is
+       dynamically typed so any column can contain the QString datetime, it has to
+       be checked for every value. */
+    if (m_isSQLiteDb && m_returnQDateTime && *m_returnQDateTime)
+        return true;
+
+    // Other drivers return the same type for all values in the column
+    return typeId == QMetaType::QDateTime;
+}
+
+int SqlQuery::fieldTypeId(const QSqlField &field)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    return field.metaType().id();
+#else
+    return static_cast<int>(field.type());
+#endif
+}
+
 std::optional<std::variant<QDateTime, QDate>>
 SqlQuery::prepareDateTime(const QVariant &value) const
 {
@@ -12,6 +12,59 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 namespace Orm::Utils
 {
 
+namespace
+{
+    /*! Determine whether the given character can be a part of an identifier. */
+    bool isIdentifierChar(const QChar character)
+    {
+        return character.isLetterOrNumber() || character == QLatin1Char('_') ||
+               character == QLatin1Char('$');
+    }
+
+    /*! Find the end of the quoted literal or identifier (index after the closing
+        quote), doubled quotes are escaped quotes. */
+    QString::size_type
+    quotedEnd(const QString &queryString, QString::size_type index)
+    {
+        const auto quote = queryString.at(index);
+        const auto size = queryString.size();
+
+        while (++index < size)
+            if (queryString.at(index) == quote) {
+                // Escaped quote
+                if (index + 1 < size && queryString.at(index + 1) == quote)
+                    ++index;
+                else
+                    return index + 1;
+            }
+
+        return size;
+    }
+
+    /*! Append the ? placeholder, repeated placeholders and value groups are
+        collapsed, eg. in (?, ?, ?) to in (?) or values (?), (?) to values (?). */
+    void appendPlaceholder(QString &fingerprint)
+    {
+        static const auto Placeholders = QStringLiteral("?, ");
+
+        if (fingerprint.endsWith(Placeholders))
+            fingerprint.chop(2);
+        else
+            fingerprint.append(QLatin1Char('?'));
+    }
+
+    /*! Collapse the repeated (?) group of the multi-row insert. */
+    void appendClosingParenthesis(QString &fingerprint)
+    {
+        static const auto Group = QStringLiteral("(?), (?");
+
+        if (fingerprint.endsWith(Group))
+            fingerprint.chop(4);
+        else
+            fingerprint.append(QLatin1Char(')'));
+    }
+} // namespace
+
 /* We don't need the Orm::SqlQuery overloads for the parseExecutedQuery() and
    logExecutedQuery() as all bindings are already prepared. */
 
@@ -82,6 +135,85 @@ int Query::queryResultSize(QSqlQuery &query)
     return size;
 }
 
+std::optional<int> Query::queryResultSizeHint(const QSqlQuery &query, const qint64 limit)
+{
+    // The size is known without fetching rows (QMYSQL and QPSQL)
+    if (query.driver()->hasFeature(QSqlDriver::QuerySize))
+        if (const auto size = query.size(); size >= 0)
+            return size;
+
+    /* Don't walk the whole result set (QSQLITE), the limit is only the upper bound,
+       so cap it to avoid huge allocations for the big limits. */
+    if (limit > -1)
+        return static_cast<int>(std::min<qint64>(limit, SizeHintLimitMax));
+
+    return std::nullopt;
+}
+
+QString Query::fingerprint(const QString &queryString)
+{
+    QString fingerprint;
+    fingerprint.reserve(queryString.size());
+
+    const auto size = queryString.size();
+    QString::size_type index = 0;
+
+    while (index < size) {
+        const auto character = queryString.at(index);
+
+        // Collapse whitespaces
+        if (character.isSpace()) {
+            if (!fingerprint.isEmpty() && !fingerprint.endsWith(QLatin1Char(' ')))
+                fingerprint.append(QLatin1Char(' '));
+
+            ++index;
+            continue;
+        }
+
+        // String literals
+        if (character == QLatin1Char('\'')) {
+            index = quotedEnd(queryString, index);
+            appendPlaceholder(fingerprint);
+            continue;
+        }
+
+        // Quoted identifiers are kept as they are
+        if (character == QLatin1Char('"') || character == QLatin1Char('`')) {
+            const auto end = quotedEnd(queryString, index);
+            fingerprint.append(queryString.constData() + index, end - index);
+            index = end;
+            continue;
+        }
+
+        // Numeric literals, but not numbers inside identifiers
+        if (character.isDigit() &&
+            (fingerprint.isEmpty() || !isIdentifierChar(fingerprint.back()))
+        ) {
+            while (index < size && (queryString.at(index).isLetterOrNumber() ||
+                                    queryString.at(index) == QLatin1Char('.'))
+            )
+                ++index;
+
+            appendPlaceholder(fingerprint);
+            continue;
+        }
+
+        if (character == QLatin1Char('?'))
+            appendPlaceholder(fingerprint);
+        else if (character == QLatin1Char(')'))
+            appendClosingParenthesis(fingerprint);
+        else
+            fingerprint.append(character);
+
+        ++index;
+    }
+
+    if (fingerprint.endsWith(QLatin1Char(' ')))
+        fingerprint.chop(1);
+
+    return fingerprint;
+}
+
 } // namespace Orm::Utils
 
 TINYORM_END_COMMON_NAMESPACE
@@ -55,6 +55,14 @@ sourcesList += \
     $$PWD/orm/schema/schemabuilder.cpp \
     $$PWD/orm/schema/sqliteschemabuilder.cpp \
     $$PWD/orm/sqliteconnection.cpp \
+    $$PWD/orm/support/connectionlease.cpp \
+    $$PWD/orm/support/connectionpool.cpp \
+    $$PWD/orm/support/jsonwriter.cpp \
+    $$PWD/orm/support/latencyhistograms.cpp \
+    $$PWD/orm/support/preparedstatementscache.cpp \
+    $$PWD/orm/support/queryanalyzer.cpp \
+    $$PWD/orm/support/readconnections.cpp \
+    $$PWD/orm/types/bindingsmap.cpp \
     $$PWD/orm/types/sqlquery.cpp \
     $$PWD/orm/utils/configuration.cpp \
     $$PWD/orm/utils/fs.cpp \
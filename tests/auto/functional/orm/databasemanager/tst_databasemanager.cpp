@@ -1,8 +1,19 @@
 #include <QCoreApplication>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QtSql/QSqlQuery>
 #include <QtTest>
 
+#include <latch>
+#include <mutex>
+#include <unordered_set>
+
 #include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
 #include "orm/exceptions/sqlitedatabasedoesnotexisterror.hpp"
+#include "orm/support/connectionpool.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -22,18 +33,25 @@ using Orm::Constants::SSL_KEY;
 using Orm::Constants::UTF8;
 using Orm::Constants::Version;
 using Orm::Constants::application_name;
+using Orm::Constants::busy_timeout;
+using Orm::Constants::cache_size;
 using Orm::Constants::charset_;
 using Orm::Constants::check_database_exists;
 using Orm::Constants::database_;
 using Orm::Constants::dont_drop;
 using Orm::Constants::driver_;
 using Orm::Constants::host_;
+using Orm::Constants::journal_mode;
+using Orm::Constants::optimize_on_disconnect;
 using Orm::Constants::options_;
+using Orm::Constants::page_size;
 using Orm::Constants::password_;
+using Orm::Constants::pool_;
 using Orm::Constants::port_;
 using Orm::Constants::prefix_;
 using Orm::Constants::prefix_indexes;
 using Orm::Constants::qt_timezone;
+using Orm::Constants::read_;
 using Orm::Constants::return_qdatetime;
 using Orm::Constants::search_path;
 using Orm::Constants::spatial_ref_sys;
@@ -42,10 +60,16 @@ using Orm::Constants::sslcert;
 using Orm::Constants::sslkey;
 using Orm::Constants::sslmode_;
 using Orm::Constants::sslrootcert;
+using Orm::Constants::sticky_;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
 using Orm::Constants::username_;
 using Orm::Constants::verify_full;
 
 using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::LogicError;
+using Orm::Exceptions::RuntimeError;
 using Orm::Exceptions::SQLiteDatabaseDoesNotExistError;
 using Orm::QtTimeZoneConfig;
 using Orm::QtTimeZoneType;
@@ -79,6 +103,15 @@ private Q_SLOTS:
     void sqlite_CheckDatabaseExists_True() const;
     void sqlite_CheckDatabaseExists_False() const;
 
+    void sqlite_Pragmas() const;
+    void sqlite_Pragmas_InvalidValue() const;
+
+    void sqlite_ConnectionPool_Lease() const;
+    void sqlite_ConnectionPool_Lease_MultipleThreads() const;
+    void sqlite_ConnectionPool_Reconnect_ConfiguresSession() const;
+
+    void sqlite_ReadWriteConnections_Sticky() const;
+
     void addUseAndRemoveConnection_FiveTimes() const;
     void addUseAndRemoveThreeConnections_FiveTimes() const;
 
@@ -783,6 +816,433 @@ void tst_DatabaseManager::sqlite_CheckDatabaseExists_False() const
     QVERIFY(!QFile::exists(checkDatabaseExistsFile()));
 }
 
+void tst_DatabaseManager::sqlite_Pragmas() const
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,                QSQLITE},
+        {database_,              directory.filePath(QStringLiteral("pragmas.sqlite3"))},
+        {check_database_exists,  false},
+        {page_size,              8192},
+        {journal_mode,           "wal"},
+        {synchronous,            "normal"},
+        {cache_size,             -4000},
+        {temp_store,             "memory"},
+        {busy_timeout,           "5000"},
+        {optimize_on_disconnect, true},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    // Values are normalized by the configuration parser
+    const auto &config = m_dm->getConfig(*connectionName);
+    QCOMPARE(config[journal_mode], QVariant(QStringLiteral("WAL")));
+    QCOMPARE(config[synchronous], QVariant(QStringLiteral("NORMAL")));
+    QCOMPARE(config[busy_timeout], QVariant(static_cast<qint64>(5000)));
+
+    // Verify
+    QCOMPARE(connection.scalar("PRAGMA page_size").value<int>(), 8192);
+    QCOMPARE(connection.scalar("PRAGMA journal_mode").value<QString>(),
+             QStringLiteral("wal"));
+    // NORMAL
+    QCOMPARE(connection.scalar("PRAGMA synchronous").value<int>(), 1);
+    QCOMPARE(connection.scalar("PRAGMA cache_size").value<int>(), -4000);
+    // MEMORY
+    QCOMPARE(connection.scalar("PRAGMA temp_store").value<int>(), 2);
+    QCOMPARE(connection.scalar("PRAGMA busy_timeout").value<int>(), 5000);
+
+    // The PRAGMA optimize runs before the connection is closed
+    connection.disconnect();
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_DatabaseManager::sqlite_Pragmas_InvalidValue() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,      QSQLITE},
+        {database_,    QStringLiteral(":memory:")},
+        {journal_mode, "fast"},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    // Verify
+    QVERIFY_EXCEPTION_THROWN(m_dm->connection(*connectionName),
+                             InvalidArgumentError);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_DatabaseManager::sqlite_ConnectionPool_Lease() const
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 8, 0)
+    QSKIP("The connection pool requires Qt >=6.8.", );
+#else
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,               QSQLITE},
+        {database_,             directory.filePath(QStringLiteral("pool.sqlite3"))},
+        {check_database_exists, false},
+        {pool_,                 QVariantHash {{"max", 1}, {"acquire_timeout", 50}}},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+    const auto pool = m_dm->connectionPool(*connectionName);
+
+    // The pooled connection can't be used outside of a lease
+    QVERIFY_EXCEPTION_THROWN(connection.scalar("select 1"), LogicError);
+
+    {
+        auto lease = m_dm->lease(*connectionName);
+
+        QVERIFY(lease.isActive());
+        QVERIFY(connection.usingPooledQtConnection());
+        QCOMPARE(connection.scalar("select 1").value<int>(), 1);
+
+        // Nested lease reuses the leased physical connection
+        {
+            auto nested = m_dm->lease(*connectionName);
+
+            QVERIFY(!nested.isActive());
+        }
+        QVERIFY(connection.usingPooledQtConnection());
+
+        // The pool is exhausted
+        QVERIFY_EXCEPTION_THROWN(pool->acquire(), RuntimeError);
+
+        const auto stats = pool->stats();
+        QCOMPARE(stats.leased, 1);
+        QCOMPARE(stats.utilization, 1.0);
+        QCOMPARE(stats.timeouts, 1);
+    }
+
+    QVERIFY(!connection.usingPooledQtConnection());
+
+    // The released physical connection is reused
+    {
+        auto lease = m_dm->lease(*connectionName);
+
+        QCOMPARE(connection.scalar("select 2").value<int>(), 2);
+    }
+
+    const auto stats = pool->stats();
+    QCOMPARE(stats.size, 1);
+    QCOMPARE(stats.idle, 1);
+    QCOMPARE(stats.leased, 0);
+    QCOMPARE(stats.acquired, 2);
+    QCOMPARE(stats.opened, 1);
+    QCOMPARE(stats.closed, 0);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+
+void tst_DatabaseManager::sqlite_ConnectionPool_Lease_MultipleThreads() const
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 8, 0)
+    QSKIP("The connection pool requires Qt >=6.8.", );
+#else
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,               QSQLITE},
+        {database_,             directory.filePath(QStringLiteral("pool.sqlite3"))},
+        {check_database_exists, false},
+        {pool_,                 QVariantHash {{"max", 2}, {"acquire_timeout", 10000}}},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    const auto pool = m_dm->connectionPool(*connectionName);
+
+    constexpr std::ptrdiff_t ThreadsCount = 4;
+
+    std::mutex mutex;
+    // Physical connections leased right now
+    std::unordered_set<QString> leased;
+    std::size_t maxLeased = 0;
+    QStringList failures;
+
+    // All threads acquire at the same time so half of them have to wait
+    std::latch start(ThreadsCount);
+
+    const auto worker = [&pool, &mutex, &leased, &maxLeased, &failures, &start]
+    {
+        start.arrive_and_wait();
+
+        try {
+            // Opens a new connection or pulls the released one to this thread
+            const auto qtConnection = pool->acquire().name;
+
+            {
+                const std::scoped_lock lock(mutex);
+
+                if (!leased.insert(qtConnection).second)
+                    failures << QStringLiteral("The '%1' connection was leased twice.")
+                                .arg(qtConnection);
+
+                maxLeased = std::max(maxLeased, leased.size());
+            }
+
+            // The QSqlDatabase is usable only from the thread it belongs to
+            {
+                QSqlQuery query(QSqlDatabase::database(qtConnection, false));
+
+                if (!query.exec(QStringLiteral("select 1")) || !query.first() ||
+                    query.value(0).value<int>() != 1
+                ) {
+                    const std::scoped_lock lock(mutex);
+
+                    failures << QStringLiteral("The query on the '%1' connection "
+                                               "failed.").arg(qtConnection);
+                }
+            }
+
+            // Hold the connection so the other threads have to wait
+            QThread::msleep(50);
+
+            {
+                const std::scoped_lock lock(mutex);
+
+                leased.erase(qtConnection);
+            }
+
+            // Pushes the connection out of this thread
+            pool->release(qtConnection);
+
+        } catch (const std::exception &e) {
+            const std::scoped_lock lock(mutex);
+
+            failures << QString::fromUtf8(e.what());
+        }
+    };
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    threads.reserve(static_cast<std::size_t>(ThreadsCount));
+
+    for (std::ptrdiff_t i = 0; i < ThreadsCount; ++i) {
+        threads.emplace_back(QThread::create(worker));
+        threads.back()->start();
+    }
+
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait(QDeadlineTimer(30'000)));
+
+    QVERIFY2(failures.isEmpty(), qPrintable(failures.join(QChar(' '))));
+    QCOMPARE(maxLeased, static_cast<std::size_t>(2));
+
+    // All connections were returned to the pool and none was closed
+    {
+        const auto stats = pool->stats();
+        QCOMPARE(stats.size, 2);
+        QCOMPARE(stats.idle, 2);
+        QCOMPARE(stats.leased, 0);
+        QCOMPARE(stats.acquired, static_cast<qint64>(ThreadsCount));
+        QCOMPARE(stats.opened, 2);
+        QCOMPARE(stats.closed, 0);
+        QVERIFY(stats.waited > 0);
+    }
+
+    // The connection opened in another thread is leased to the main thread
+    {
+        auto lease = m_dm->lease(*connectionName);
+
+        QCOMPARE(m_dm->connection(*connectionName).scalar("select 1").value<int>(), 1);
+    }
+
+    QCOMPARE(pool->stats().opened, 2);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+
+void tst_DatabaseManager::sqlite_ConnectionPool_Reconnect_ConfiguresSession() const
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 8, 0)
+    QSKIP("The connection pool requires Qt >=6.8.", );
+#else
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,               QSQLITE},
+        {database_,             directory.filePath(QStringLiteral("pool.sqlite3"))},
+        {check_database_exists, false},
+        {cache_size,            -4000},
+        {pool_,                 QVariantHash {{"max", 1}}},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+    const auto pool = m_dm->connectionPool(*connectionName);
+
+    {
+        auto lease = m_dm->lease(*connectionName);
+
+        QCOMPARE(connection.scalar("PRAGMA cache_size").value<int>(), -4000);
+
+        // The leased physical connection is reopened with the configured session
+        m_dm->reconnect(*connectionName);
+
+        QVERIFY(connection.usingPooledQtConnection());
+        QCOMPARE(connection.scalar("PRAGMA cache_size").value<int>(), -4000);
+    }
+
+    // The same physical connection was returned to the pool
+    const auto stats = pool->stats();
+    QCOMPARE(stats.idle, 1);
+    QCOMPARE(stats.opened, 1);
+    QCOMPARE(stats.closed, 0);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+#endif
+}
+
+void tst_DatabaseManager::sqlite_ReadWriteConnections_Sticky() const
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    // Add a new database connection, the read replica is a different database file
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,               QSQLITE},
+        {database_,             directory.filePath(QStringLiteral("write.sqlite3"))},
+        {check_database_exists, false},
+        {read_,                 QVariantHash {{database_, directory.filePath(
+                                                   QStringLiteral("read.sqlite3"))}}},
+        {sticky_,               true},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    QVERIFY(connection.hasReadConnections());
+    QVERIFY(connection.isSticky());
+
+    // Prepare the read replica first, nothing was written yet
+    {
+        QSqlQuery query(connection.getReadQtConnection());
+        QVERIFY(query.exec("create table servers (name varchar(255))"));
+        QVERIFY(query.exec("insert into servers values ('read')"));
+    }
+
+    QVERIFY(!connection.getRecordsHaveBeenModified());
+    connection.statement("create table servers (name varchar(255))");
+    connection.statement("insert into servers values ('write')");
+
+    // Verify
+    const auto selectName = [&connection]
+    {
+        return connection.scalar("select name from servers").value<QString>();
+    };
+
+    // Sticky, the records were modified so reads use the write connection
+    QCOMPARE(selectName(), QStringLiteral("write"));
+
+    // The following write that doesn't modify any records can't reset the state
+    QCOMPARE(std::get<0>(
+                 connection.update("update servers set name = 'x' where name = 'y'")),
+             0);
+    QVERIFY(connection.getRecordsHaveBeenModified());
+    QCOMPARE(selectName(), QStringLiteral("write"));
+
+    connection.forgetRecordModificationState();
+    QCOMPARE(selectName(), QStringLiteral("read"));
+
+    // Query builder
+    QCOMPARE(m_dm->table("servers", *connectionName)->value("name"),
+             QVariant(QStringLiteral("read")));
+    QCOMPARE(m_dm->table("servers", *connectionName)->useWriteConnection()
+             .value("name"),
+             QVariant(QStringLiteral("write")));
+
+    // Explicit write connection
+    {
+        auto query = connection.selectFromWriteConnection("select name from servers");
+        QVERIFY(query.first());
+        QCOMPARE(query.value("name"), QVariant(QStringLiteral("write")));
+    }
+
+    // Transactions use the write connection
+    QVERIFY(connection.beginTransaction());
+    QCOMPARE(selectName(), QStringLiteral("write"));
+    QVERIFY(connection.rollBack());
+
+    QCOMPARE(selectName(), QStringLiteral("read"));
+
+    // Read replicas are resolved again after the reconnect
+    m_dm->reconnect(*connectionName);
+    QCOMPARE(selectName(), QStringLiteral("read"));
+
+    const auto readQtConnections = connection.getReadConnections().qtConnectionNames();
+    QCOMPARE(readQtConnections.size(), 1);
+    QVERIFY(QSqlDatabase::contains(readQtConnections.constFirst()));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+
+    // Read replicas are removed from the QSqlDatabase with the connection
+    QVERIFY(!QSqlDatabase::contains(readQtConnections.constFirst()));
+}
+
 void tst_DatabaseManager::addUseAndRemoveConnection_FiveTimes() const
 {
     for (auto i = 0; i < 5; ++i) {
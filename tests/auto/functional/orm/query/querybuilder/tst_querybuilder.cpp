@@ -126,6 +126,11 @@ private Q_SLOTS:
     void each_ReturnFalse() const;
     void each_EnforceOrderBy() const;
     void each_EmptyResult() const;
+    void each_ForwardOnly() const;
+    void pluck_ForwardOnly() const;
+
+    void cursor() const;
+    void cursor_EmptyResult() const;
 
     void chunkById() const;
     void chunkById_ReturnFalse() const;
@@ -1840,6 +1845,103 @@ void tst_QueryBuilder::each_EmptyResult() const
     QVERIFY(result);
 }
 
+void tst_QueryBuilder::each_ForwardOnly() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    std::vector<qint64> indexes;
+    indexes.reserve(8);
+    std::vector<quint64> ids;
+    ids.reserve(8);
+
+    auto builder = createQuery(connection);
+
+    builder->from("file_property_properties").orderBy(ID).forwardOnly();
+
+    QVERIFY(builder->isForwardOnly());
+
+    // All rows are streamed using one query, the count argument is ignored
+    auto result = builder->each([&indexes, &ids](SqlQuery &query, const qint64 index)
+    {
+        indexes.emplace_back(index);
+        ids.emplace_back(query.value(ID).value<quint64>());
+
+        return true;
+    }, 3);
+
+    QVERIFY(result);
+
+    std::vector<qint64> expectedIndexes {0, 1, 2, 3, 4, 5, 6, 7};
+    std::vector<quint64> expectedIds {1, 2, 3, 4, 5, 6, 7, 8};
+
+    QVERIFY(indexes.size() == expectedIndexes.size());
+    QCOMPARE(indexes, expectedIndexes);
+    QVERIFY(ids.size() == expectedIds.size());
+    QCOMPARE(ids, expectedIds);
+}
+
+void tst_QueryBuilder::pluck_ForwardOnly() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    {
+        auto builder = createQuery(connection);
+
+        auto result = builder->from("torrents").orderBy(NAME).forwardOnly()
+                      .pluck(NAME);
+
+        QVector<QVariant> expected {
+            "test1", "test2", "test3", "test4", "test5", "test6", "test7",
+        };
+        QCOMPARE(result, expected);
+    }
+    // Empty result
+    {
+        auto builder = createQuery(connection);
+
+        auto result = builder->from("torrents")
+                      .whereEq(NAME, "dummy-NON_EXISTENT").forwardOnly().pluck(NAME);
+
+        QCOMPARE(result, QVector<QVariant>());
+    }
+    // The forward-only mode is passed down to the QSqlQuery
+    {
+        auto query = createQuery(connection)->from("torrents").forwardOnly().get();
+
+        QVERIFY(query.isForwardOnly());
+    }
+}
+
+void tst_QueryBuilder::cursor() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    std::vector<quint64> ids;
+    ids.reserve(8);
+
+    for (auto &query : createQuery(connection)->from("file_property_properties")
+                       .orderBy(ID).cursor()
+    ) {
+        QVERIFY(query.isForwardOnly());
+        ids.emplace_back(query.value(ID).value<quint64>());
+    }
+
+    std::vector<quint64> expectedIds {1, 2, 3, 4, 5, 6, 7, 8};
+
+    QVERIFY(ids.size() == expectedIds.size());
+    QCOMPARE(ids, expectedIds);
+}
+
+void tst_QueryBuilder::cursor_EmptyResult() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto rows = createQuery(connection)->from("file_property_properties")
+                .whereEq(NAME, "dummy-NON_EXISTENT").cursor();
+
+    QVERIFY(rows.begin() == rows.end());
+}
+
 void tst_QueryBuilder::chunkById() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -105,6 +105,8 @@ private Q_SLOTS:
     void mergeCasts_const_lvalue() const;
     void mergeCasts_lvalue() const;
     void mergeCasts_rvalue() const;
+    void getCasts_Incrementing_Recomputed() const;
+    void conversionPlan_Hydration_ComputedOnce() const;
 
     void withCasts_OnTinyBuilder() const;
     void withCasts_OnModel() const;
@@ -426,6 +428,52 @@ void tst_CastAttributes::mergeCasts_rvalue() const
     QVERIFY(toMerge.empty()); // NOLINT(bugprone-use-after-move)
 }
 
+void tst_CastAttributes::getCasts_Incrementing_Recomputed() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &type = model(connection);
+
+    QVERIFY(type.getCasts().contains(type.getKeyName()));
+
+    // The primary key cast is added only for the incrementing primary key
+    type.setIncrementing(false);
+
+    QVERIFY(!type.getCasts().contains(type.getKeyName()));
+
+    // Restore
+    type.setIncrementing(true);
+
+    QVERIFY(type.getCasts().contains(type.getKeyName()));
+    QCOMPARE(type.getCasts().at(type.getKeyName()).type(), CastType::ULongLong);
+}
+
+void tst_CastAttributes::conversionPlan_Hydration_ComputedOnce() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    // Compute the conversion plan for the reset casts
+    std::ignore = model(connection).getCasts();
+
+    const auto buildsCount = Type::getConversionPlanBuildsCount();
+
+    auto types = Type::on(connection)->get();
+
+    QCOMPARE(types.size(), 3);
+
+    // Hydration and attribute casting must reuse the same conversion plan
+    for (const auto &type : types) {
+        QCOMPARE(type.getCasts().size(), 1);
+        std::ignore = type.getAttribute("smallint");
+    }
+
+    // Merging the same casts doesn't invalidate the conversion plan
+    types.first().mergeCasts(std::unordered_map<QString, CastItem> {});
+    std::ignore = types.first().getCasts();
+
+    QCOMPARE(Type::getConversionPlanBuildsCount(), buildsCount);
+}
+
 void tst_CastAttributes::withCasts_OnTinyBuilder() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -61,12 +61,16 @@ private Q_SLOTS:
     void save_Update_WithNullValue() const;
     void save_Update_Failed() const;
 
+    void saveAll_Insert_Update() const;
+    void saveAll_Failed_RestoresModels() const;
+
     void remove() const;
     void destroy() const;
     void destroyWithVector() const;
 
     void all() const;
     void all_Columns() const;
+    void all_SharedAttributesLayout() const;
 
     void latest() const;
     void oldest() const;
@@ -120,6 +124,7 @@ private Q_SLOTS:
     void update_SameValue() const;
 
     void upsert() const;
+    void upsert_Collection() const;
 
     void truncate() const;
 
@@ -391,6 +396,124 @@ void tst_Model::save_Update_Failed() const
     QVERIFY(peer->exists);
 }
 
+void tst_Model::saveAll_Insert_Update() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    const auto addedOn = QDateTime({2020, 10, 1}, {20, 22, 10}, Qt::UTC);
+
+    ModelsCollection<Torrent> torrents;
+    torrents.reserve(3);
+
+    for (auto i = 52; i < 55; ++i) {
+        const auto hash = QString::number(i) +
+                          QStringLiteral("79e3af2768cdf52ec84c1f320333f68401dc61");
+
+        Torrent torrent;
+        torrent.setAttribute(NAME, QStringLiteral("test%1").arg(i))
+               .setAttribute(SIZE_, i)
+               .setAttribute(Progress, i)
+               .setAttribute("added_on", addedOn)
+               .setAttribute(HASH_, hash);
+
+        torrents << std::move(torrent);
+    }
+
+    // Insert
+    QVERIFY(torrents.saveAll());
+
+    for (auto i = 52; const auto &torrent : torrents) {
+        QVERIFY(torrent.exists);
+        QVERIFY(!torrent.isDirty());
+        QVERIFY(torrent.getKeyCasted() > 6);
+        QVERIFY(torrent.getAttribute(CREATED_AT).isValid());
+        QVERIFY(torrent.getAttribute(UPDATED_AT).isValid());
+
+        // The generated keys are assigned in the order of the inserted models
+        auto torrentToVerify = Torrent::find(torrent.getKey());
+        QVERIFY(torrentToVerify);
+        QCOMPARE(torrentToVerify->getAttribute(NAME),
+                 QVariant(QStringLiteral("test%1").arg(i++)));
+    }
+
+    // Update only some of the models, others aren't dirty
+    torrents[0].setAttribute(Progress, 152);
+    torrents[2].setAttribute(Progress, 154);
+
+    QVERIFY(torrents.saveAll());
+
+    for (auto i = 52; const auto &torrent : torrents) {
+        QVERIFY(!torrent.isDirty());
+
+        auto torrentToVerify = Torrent::find(torrent.getKey());
+        QVERIFY(torrentToVerify);
+        QCOMPARE(torrentToVerify->getAttribute(Progress),
+                 QVariant(i == 53 ? 53 : i + 100));
+        ++i;
+    }
+
+    QVERIFY(torrents.at(0).wasChanged(Progress));
+    QVERIFY(!torrents.at(1).wasChanged(Progress));
+
+    // Remove them
+    for (auto &torrent : torrents)
+        torrent.remove();
+}
+
+void tst_Model::saveAll_Failed_RestoresModels() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    ModelsCollection<Torrent> torrents;
+    torrents.reserve(2);
+
+    // The new model is inserted before the existing one is updated
+    {
+        Torrent torrent;
+        torrent.setAttribute(NAME, QStringLiteral("test55"))
+               .setAttribute(SIZE_, 55)
+               .setAttribute(Progress, 55)
+               .setAttribute("added_on",
+                             QDateTime({2020, 10, 1}, {20, 22, 10}, Qt::UTC))
+               .setAttribute(HASH_, QStringLiteral(
+                                        "5579e3af2768cdf52ec84c1f320333f68401dc61"));
+
+        torrents << std::move(torrent);
+    }
+    {
+        auto torrent = Torrent::find(1);
+        QVERIFY(torrent);
+
+        torrent->setAttribute("progress-NON_EXISTENT", 101);
+
+        torrents << std::move(*torrent);
+    }
+
+    const auto updatedAt = torrents.at(1).getAttribute(UPDATED_AT);
+
+    QVERIFY_EXCEPTION_THROWN(torrents.saveAll(), QueryError);
+
+    // The inserted model was rolled back
+    const auto &inserted = torrents.at(0);
+    QVERIFY(!inserted.exists);
+    QVERIFY(!inserted.getKey().isValid());
+    QVERIFY(!inserted.getAttribute(CREATED_AT).isValid());
+    QVERIFY(inserted.isDirty());
+    QCOMPARE(DB::table("torrents", connection)->where(NAME, "=", "test55").count(),
+             0);
+
+    // The updated model wasn't touched
+    const auto &updated = torrents.at(1);
+    QVERIFY(updated.exists);
+    QVERIFY(updated.isDirty("progress-NON_EXISTENT"));
+    QCOMPARE(updated.getAttribute(UPDATED_AT), updatedAt);
+    QVERIFY(!updated.wasChanged());
+}
+
 void tst_Model::remove() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -538,6 +661,49 @@ void tst_Model::all_Columns() const
     }
 }
 
+void tst_Model::all_SharedAttributesLayout() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto torrents = Torrent::all();
+
+    QCOMPARE(torrents.size(), 7);
+
+    auto &torrent1 = torrents[0];
+    const auto &torrent2 = torrents[1];
+
+    // Models hydrated from the same result set share the attributes layout
+    QCOMPARE(&torrent1.getAttributesHash(), &torrent2.getAttributesHash());
+    QCOMPARE(&torrent1.getAttributesHash(), &torrent1.getOriginalsHash());
+    QVERIFY(torrent1.isClean());
+
+    // Setting an existing attribute doesn't change the layout
+    torrent1.setAttribute(NAME, "test1 dirty");
+
+    QCOMPARE(&torrent1.getAttributesHash(), &torrent2.getAttributesHash());
+    QVERIFY(torrent1.isDirty(NAME));
+    QCOMPARE(torrent1.getDirty().size(), 1);
+
+    // Adding a new attribute detaches the layout, other models are untouched
+    torrent1.setAttribute("dummy_attribute", 1);
+
+    QVERIFY(&torrent1.getAttributesHash() != &torrent2.getAttributesHash());
+    QVERIFY(torrent1.getAttributesHash().contains("dummy_attribute"));
+    QVERIFY(!torrent2.getAttributesHash().contains("dummy_attribute"));
+    QVERIFY(!torrent1.getOriginalsHash().contains("dummy_attribute"));
+    QCOMPARE(torrent1.getAttributesHash().size(),
+             torrent2.getAttributesHash().size() + 1);
+
+    // Sync the original, the layout is shared again
+    torrent1.syncOriginal();
+
+    QCOMPARE(&torrent1.getAttributesHash(), &torrent1.getOriginalsHash());
+    QVERIFY(torrent1.isClean());
+    QVERIFY(torrent2.isClean());
+}
+
 void tst_Model::latest() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -1669,6 +1835,64 @@ void tst_Model::upsert() const
     }
 }
 
+void tst_Model::upsert_Collection() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    // Get an original timestamp values for restoration
+    const auto &createdAtColumn = TagProperty::getCreatedAtColumn();
+    const auto &updatedAtColumn = TagProperty::getUpdatedAtColumn();
+    auto tagProperty1Original = TagProperty::find(1);
+    QVERIFY(tagProperty1Original);
+    auto createdAtOriginal = tagProperty1Original->getAttribute(createdAtColumn);
+    auto updatedAtOriginal = tagProperty1Original->getAttribute(updatedAtColumn);
+
+    ModelsCollection<TagProperty> tagProperties;
+    tagProperties.reserve(2);
+
+    for (const auto &[color, position] : {std::pair {"pink", 0},
+                                          std::pair {"purple", 4}}
+    ) {
+        TagProperty tagProperty;
+        tagProperty.setAttribute("tag_id", 1)
+                   .setAttribute("color", color)
+                   .setAttribute("position", position);
+
+        tagProperties << std::move(tagProperty);
+    }
+
+    // Should update one row (color column) and insert one row
+    auto affected = tagProperties.upsert({"position"}, {"color"});
+
+    if (DB::driverName(connection) == QMYSQL)
+        QCOMPARE(affected, 3);
+    else
+        QCOMPARE(affected, 2);
+
+    // The state of the models is not changed
+    for (const auto &tagProperty : tagProperties)
+        QVERIFY(!tagProperty.exists);
+
+    auto tagPropertiesVerify = TagProperty::whereEq("tag_id", 1)
+                               ->orderBy("position")
+                               .get();
+
+    QCOMPARE(tagPropertiesVerify.size(), 2);
+    QCOMPARE(tagPropertiesVerify.at(0).getAttribute("color"), QVariant("pink"));
+    QCOMPARE(tagPropertiesVerify.at(1).getAttribute("color"), QVariant("purple"));
+    QVERIFY(tagPropertiesVerify.at(1).getAttribute(createdAtColumn).isValid());
+
+    // Restore db
+    DB::table("tag_properties", connection)->whereEq("position", 4).remove();
+    DB::table("tag_properties", connection)
+            ->whereEq(ID, 1)
+            .update({{"color", "white"},
+                     {createdAtColumn, createdAtOriginal},
+                     {updatedAtColumn, updatedAtOriginal}});
+}
+
 void tst_Model::truncate() const
 {
     QFETCH_GLOBAL(QString, connection);
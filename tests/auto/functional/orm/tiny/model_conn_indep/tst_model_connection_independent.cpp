@@ -1,6 +1,8 @@
 #include <QCoreApplication>
 #include <QtTest>
 
+#include <ranges>
+
 #include "orm/db.hpp"
 
 #include "databases.hpp"
@@ -108,6 +110,7 @@ private Q_SLOTS:
     /* Eager loading */
     void with_WithSelectConstraint_WithoutQualifiedColumnsForRelatedTable() const;
     void with_BelongsToMany_WithSelectConstraint_QualifiedColumnsForRelatedTable() const;
+    void with_EagerChunkSize() const;
 
     /* Retrieving results */
     void pluck() const;
@@ -134,6 +137,10 @@ private Q_SLOTS:
     void each_EnforceOrderBy() const;
     void each_EmptyResult() const;
 
+    void cursor() const;
+    void cursor_Views() const;
+    void cursor_EmptyResult() const;
+
     void chunkMap() const;
     void chunkMap_EnforceOrderBy() const;
     void chunkMap_EmptyResult() const;
@@ -1001,6 +1008,50 @@ void tst_Model_Connection_Independent::
                  "where `tag_torrent`.`torrent_id` in (?)"));
 }
 
+void tst_Model_Connection_Independent::with_EagerChunkSize() const
+{
+    // Eager loaded without chunking
+    auto expected = Torrent::with("torrentFiles")->orderBy(ID).get();
+
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    auto torrents = Torrent::with("torrentFiles")->eagerChunkSize(3).orderBy(ID).get();
+    DB::disableQueryLog(m_connection);
+
+    QCOMPARE(torrents.size(), 7);
+    QCOMPARE(torrents.size(), expected.size());
+
+    // 7 torrents loaded in 3 chunks
+    const auto queryLog = DB::getQueryLog(m_connection);
+
+    QCOMPARE(queryLog->size(), 4);
+    QCOMPARE(queryLog->at(1).query,
+             QString("select * from `torrent_previewable_files` "
+                     "where `torrent_previewable_files`.`torrent_id` in (?, ?, ?)"));
+    QCOMPARE(queryLog->at(2).query,
+             QString("select * from `torrent_previewable_files` "
+                     "where `torrent_previewable_files`.`torrent_id` in (?, ?, ?)"));
+    QCOMPARE(queryLog->at(3).query,
+             QString("select * from `torrent_previewable_files` "
+                     "where `torrent_previewable_files`.`torrent_id` in (?)"));
+
+    // All chunks must be matched to the correct torrents
+    for (ModelsCollection<Torrent>::size_type i = 0; i < torrents.size(); ++i) {
+        auto &torrent = torrents[i];
+        QCOMPARE(torrent.getKey(), expected[i].getKey());
+
+        auto files = torrent.getRelation<TorrentPreviewableFile>("torrentFiles");
+        auto expectedFiles = expected[i]
+                             .getRelation<TorrentPreviewableFile>("torrentFiles");
+        QCOMPARE(files.size(), expectedFiles.size());
+
+        for (auto *file : files) {
+            QVERIFY(file);
+            QCOMPARE(file->getAttribute("torrent_id"), torrent.getKey());
+        }
+    }
+}
+
 /* Retrieving results */
 
 void tst_Model_Connection_Independent::pluck() const
@@ -1586,6 +1637,53 @@ namespace
     };
 } // namespace
 
+void tst_Model_Connection_Independent::cursor() const
+{
+    std::vector<quint64> ids;
+    ids.reserve(8);
+
+    for (auto &model : FilePropertyProperty::orderBy(ID)->cursor()) {
+        QVERIFY(model.exists);
+        ids.emplace_back(model.getKeyCasted());
+    }
+
+    std::vector<quint64> expectedIds {1, 2, 3, 4, 5, 6, 7, 8};
+
+    QVERIFY(ids.size() == expectedIds.size());
+    QCOMPARE(ids, expectedIds);
+}
+
+void tst_Model_Connection_Independent::cursor_Views() const
+{
+    auto ids = FilePropertyProperty::orderBy(ID)->cursor()
+               | std::views::filter([](const FilePropertyProperty &model)
+    {
+        return model.getKeyCasted() % 2 == 0;
+    })
+               | std::views::transform([](const FilePropertyProperty &model)
+    {
+        return model.getKeyCasted();
+    });
+
+    std::vector<quint64> result;
+    result.reserve(4);
+
+    for (const auto id : ids)
+        result.emplace_back(id);
+
+    std::vector<quint64> expectedIds {2, 4, 6, 8};
+
+    QVERIFY(result.size() == expectedIds.size());
+    QCOMPARE(result, expectedIds);
+}
+
+void tst_Model_Connection_Independent::cursor_EmptyResult() const
+{
+    auto models = FilePropertyProperty::whereEq(NAME, "dummy-NON_EXISTENT")->cursor();
+
+    QVERIFY(models.begin() == models.end());
+}
+
 void tst_Model_Connection_Independent::chunkMap() const
 {
     auto result = FilePropertyProperty::orderBy(ID)
@@ -76,6 +76,10 @@ private Q_SLOTS:
     /* Server timezone UTC */
     void create_QDateTime_0300Timezone_DatetimeAttribute_UtcOnServer_DontConvert() const;
 
+    /* Value conversions */
+    void valueConversions_ResolvedForColumns() const;
+    void valueConversions_DontConvert() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Set the MySQL/PostgreSQL timezone session variable to the UTC value. */
@@ -1320,6 +1324,54 @@ create_QDateTime_0300Timezone_DatetimeAttribute_UtcOnServer_DontConvert() const
              (QtTimeZoneConfig {QtTimeZoneType::QtTimeSpec,
                                 QVariant::fromValue(Qt::UTC)}));
 }
+
+/* Value conversions */
+
+void tst_Model_QDateTime::valueConversions_ResolvedForColumns() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto query = DB::table("datetimes", connection)
+                 ->select({ID, *datetime_, *date})
+                 .limit(1)
+                 .get();
+
+    const auto conversions = query.valueConversions(query.record());
+
+    using ValueConversion = Orm::SqlQuery::ValueConversion;
+
+    QCOMPARE(conversions.size(), 3);
+
+    /* SQLite is dynamically typed so all columns have to be converted by value,
+       other drivers convert only the QDateTime columns. */
+    if (DB::driverName(connection) == QSQLITE)
+        QCOMPARE(conversions, QVector<ValueConversion>(3, ValueConversion::DATETIME));
+    else
+        QCOMPARE(conversions, (QVector<ValueConversion> {ValueConversion::NONE,
+                                                          ValueConversion::DATETIME,
+                                                          ValueConversion::NONE}));
+}
+
+void tst_Model_QDateTime::valueConversions_DontConvert() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    DB::setQtTimeZone(QtTimeZoneConfig {QtTimeZoneType::DontConvert}, connection);
+
+    auto query = DB::table("datetimes", connection)
+                 ->select({ID, *datetime_, *date})
+                 .limit(1)
+                 .get();
+
+    const auto conversions = query.valueConversions(query.record());
+
+    using ValueConversion = Orm::SqlQuery::ValueConversion;
+
+    QCOMPARE(conversions, QVector<ValueConversion>(3, ValueConversion::NONE));
+
+    DB::setQtTimeZone(QtTimeZoneConfig {QtTimeZoneType::QtTimeSpec,
+                                        QVariant::fromValue(Qt::UTC)}, connection);
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
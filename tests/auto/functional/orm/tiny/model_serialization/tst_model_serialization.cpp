@@ -140,6 +140,11 @@ private Q_SLOTS:
     void toJson_RelationOnly_HasMany() const;
     void toJson_RelationOnly_BelongsToMany() const;
 
+    void writeJson_WithRelations() const;
+    void writeJson_RelationOnly_BelongsToMany() const;
+    void writeJson_QIODevice() const;
+    void writeJson_UuidAndUrl() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Connection name used in this test case. */
@@ -2914,6 +2919,79 @@ R"([
 
     QCOMPARE(json, expectedJson);
 }
+
+void tst_Model_Serialization::writeJson_WithRelations() const
+{
+    auto torrent = Torrent::with({"torrentPeer", "user", "torrentFiles", "tags"})
+                   ->find(7);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+
+    // The buffer is reused, the JSON is appended to it
+    QByteArray json;
+    json.reserve(4096);
+
+    torrent->writeJson(json);
+
+    QCOMPARE(QJsonDocument::fromJson(json), torrent->toJsonDocument());
+
+    json.resize(0);
+    torrent->writeJson(json, QJsonDocument::Indented);
+
+    QCOMPARE(QJsonDocument::fromJson(json), torrent->toJsonDocument());
+}
+
+void tst_Model_Serialization::writeJson_RelationOnly_BelongsToMany() const
+{
+    auto user = User::with("roles")->find(1);
+    QVERIFY(user);
+    QVERIFY(user->exists);
+
+    ModelsCollection<Role *> roles = user->getRelationValue<Role>("roles");
+    QCOMPARE(roles.size(), 3);
+
+    QByteArray json;
+    roles.template writeJson<RoleUser>(json);
+
+    QCOMPARE(QJsonDocument::fromJson(json),
+             roles.template toJsonDocument<RoleUser>());
+}
+
+void tst_Model_Serialization::writeJson_QIODevice() const
+{
+    auto torrents = Torrent::with("torrentFiles")->get();
+    QVERIFY(!torrents.isEmpty());
+
+    QByteArray json;
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+    QVERIFY(torrents.writeJson(buffer));
+    buffer.close();
+
+    QCOMPARE(QJsonDocument::fromJson(json), torrents.toJsonDocument());
+}
+
+void tst_Model_Serialization::writeJson_UuidAndUrl() const
+{
+    auto torrent = Torrent::find(7);
+    QVERIFY(torrent);
+    QVERIFY(torrent->exists);
+
+    const QUuid uuid(QStringLiteral("{0b5bf9c4-7e8a-4c2a-9a4e-5f0e6d1c2b3a}"));
+
+    torrent->setAttribute("uuid", uuid);
+    torrent->setAttribute("url", QUrl(QStringLiteral("https://example.com/a b?c=d e")));
+
+    QByteArray json;
+    torrent->writeJson(json);
+
+    // The same as the QJsonValue::fromVariant()
+    QVERIFY(json.contains(R"("uuid":"0b5bf9c4-7e8a-4c2a-9a4e-5f0e6d1c2b3a")"));
+    QVERIFY(json.contains(R"("url":"https://example.com/a%20b?c=d%20e")"));
+
+    QCOMPARE(QJsonDocument::fromJson(json), torrent->toJsonDocument());
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 QTEST_MAIN(tst_Model_Serialization)
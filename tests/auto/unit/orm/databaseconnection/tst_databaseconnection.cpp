@@ -5,6 +5,8 @@
 #include "orm/db.hpp"
 #include "orm/exceptions/multiplecolumnsselectederror.hpp"
 #include "orm/mysqlconnection.hpp"
+#include "orm/support/latencyhistograms.hpp"
+#include "orm/utils/query.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -23,10 +25,14 @@ using Orm::Constants::timezone_;
 using Orm::DB;
 using Orm::Exceptions::MultipleColumnsSelectedError;
 using Orm::MySqlConnection;
+using Orm::QueryIssue;
+using Orm::StatementType;
+using Orm::Support::LatencyHistograms;
 using Orm::QtTimeZoneConfig;
 using Orm::QtTimeZoneType;
 
 using QueryBuilder = Orm::Query::Builder;
+using QueryUtils = Orm::Utils::Query;
 using TypeUtils = Orm::Utils::Type;
 
 using TestUtils::Databases;
@@ -60,6 +66,21 @@ private Q_SLOTS:
     void scalar_EmptyResult() const;
     void scalar_MultipleColumnsSelectedError() const;
 
+    void preparedStatementsCache_HitsAndMisses() const;
+    void preparedStatementsCache_Evictions() const;
+    void preparedStatementsCache_FlushedOnDisconnect() const;
+    void preparedStatementsCache_NestedLoop() const;
+    void preparedStatementsCache_RepeatedSelect() const;
+    void preparedStatementsCache_ForwardOnlyMode() const;
+
+    void connectElapsed_CountedOnReconnect() const;
+
+    void latencyHistograms_Fingerprint() const;
+    void latencyHistograms_Record() const;
+
+    void queryLog_Bounded() const;
+    void queryAnalyzer_NPlusOne() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Create QueryBuilder instance for the given connection. */
@@ -873,6 +894,358 @@ void tst_DatabaseConnection::scalar_MultipleColumnsSelectedError() const
                                  "select id, name from torrents order by id"),
                              MultipleColumnsSelectedError);
 }
+
+void tst_DatabaseConnection::preparedStatementsCache_HitsAndMisses() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.enablePreparedStatementsCache(2);
+    QVERIFY(connectionRef.usingPreparedStatementsCache());
+
+    for (const auto id : {1, 2, 3}) {
+        auto query = connectionRef.selectOne(
+                         "select name from torrents where id = ?", {id});
+
+        QCOMPARE(query.value(NAME), QVariant(QStringLiteral("test%1").arg(id)));
+
+        // Release the result so the cached prepared statement can be re-used
+        query.finish();
+    }
+
+    const auto counter = connectionRef.takePreparedStatementsCacheCounter();
+
+    QCOMPARE(counter.hits, 2);
+    QCOMPARE(counter.misses, 1);
+    QCOMPARE(counter.evictions, 0);
+
+    connectionRef.disablePreparedStatementsCache();
+    QVERIFY(!connectionRef.usingPreparedStatementsCache());
+    QCOMPARE(connectionRef.getPreparedStatementsCacheCounter().hits, -1);
+}
+
+void tst_DatabaseConnection::preparedStatementsCache_Evictions() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.enablePreparedStatementsCache(2);
+
+    std::ignore = connectionRef.scalar("select name from torrents where id = ?", {1});
+    std::ignore = connectionRef.scalar("select size from torrents where id = ?", {1});
+    // Evicts the first statement
+    std::ignore = connectionRef.scalar("select note from torrents where id = ?", {1});
+    // Prepared again
+    std::ignore = connectionRef.scalar("select name from torrents where id = ?", {1});
+    // Still cached
+    std::ignore = connectionRef.scalar("select note from torrents where id = ?", {1});
+
+    const auto &counter = connectionRef.getPreparedStatementsCacheCounter();
+
+    QCOMPARE(counter.hits, 1);
+    QCOMPARE(counter.misses, 4);
+    QCOMPARE(counter.evictions, 2);
+
+    connectionRef.disablePreparedStatementsCache();
+}
+
+void tst_DatabaseConnection::preparedStatementsCache_FlushedOnDisconnect() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.enablePreparedStatementsCache(2);
+
+    std::ignore = connectionRef.scalar("select name from torrents where id = ?", {1});
+
+    connectionRef.disconnect();
+
+    // Prepared again on the new connection
+    auto name = connectionRef.scalar("select name from torrents where id = ?", {1});
+
+    QCOMPARE(name, QVariant(QStringLiteral("test1")));
+
+    const auto &counter = connectionRef.getPreparedStatementsCacheCounter();
+
+    QCOMPARE(counter.hits, 0);
+    QCOMPARE(counter.misses, 2);
+
+    connectionRef.disablePreparedStatementsCache();
+}
+
+void tst_DatabaseConnection::preparedStatementsCache_NestedLoop() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.enablePreparedStatementsCache(2);
+
+    const auto *const sql = "select id, name from torrents where id <= ? order by id";
+
+    auto outer = connectionRef.select(sql, {3});
+
+    QVector<quint64> outerIds;
+    QVector<QString> innerNames;
+
+    while (outer.next()) {
+        outerIds << outer.value(ID).value<quint64>();
+
+        // The same SQL query while the outer result is still iterated
+        auto inner = connectionRef.select(sql, {1});
+
+        while (inner.next())
+            innerNames << inner.value(NAME).value<QString>();
+    }
+
+    // The outer result wasn't clobbered by the inner query
+    QCOMPARE(outerIds, QVector<quint64>({1, 2, 3}));
+    QCOMPARE(innerNames, QVector<QString>({"test1", "test1", "test1"}));
+
+    const auto &counter = connectionRef.getPreparedStatementsCacheCounter();
+
+    /* The first inner query was prepared again because the outer result is active,
+       the following inner queries re-use the previous inner query because its result
+       was traversed to the end. */
+    QCOMPARE(counter.hits, 2);
+    QCOMPARE(counter.misses, 2);
+
+    connectionRef.disablePreparedStatementsCache();
+}
+
+void tst_DatabaseConnection::preparedStatementsCache_RepeatedSelect() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.enablePreparedStatementsCache(2);
+
+    const auto *const sql = "select name from torrents where id = ?";
+
+    // The result traversed to the end is released on the next select() call
+    for (const auto id : {1, 2, 3}) {
+        auto query = connectionRef.select(sql, {id});
+
+        QVector<QString> names;
+        while (query.next())
+            names << query.value(NAME).value<QString>();
+
+        QCOMPARE(names, QVector<QString>({QStringLiteral("test%1").arg(id)}));
+    }
+
+    {
+        const auto counter = connectionRef.takePreparedStatementsCacheCounter();
+
+        QCOMPARE(counter.hits, 2);
+        QCOMPARE(counter.misses, 1);
+    }
+
+    /* The result that wasn't traversed to the end or released using the finish() is
+       still active, so the next select() call has to prepare the query again. */
+    for (const auto id : {1, 2, 3}) {
+        auto query = connectionRef.select(sql, {id});
+
+        QVERIFY(query.first());
+        QCOMPARE(query.value(NAME), QVariant(QStringLiteral("test%1").arg(id)));
+    }
+
+    {
+        const auto counter = connectionRef.takePreparedStatementsCacheCounter();
+
+        QCOMPARE(counter.hits, 1);
+        QCOMPARE(counter.misses, 2);
+    }
+
+    connectionRef.disablePreparedStatementsCache();
+}
+
+void tst_DatabaseConnection::preparedStatementsCache_ForwardOnlyMode() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.enablePreparedStatementsCache(2);
+
+    const auto *const sql = "select name from torrents where id = ?";
+
+    connectionRef.select(sql, {1}, false).finish();
+
+    // The forward-only mode can't be changed on the prepared query
+    {
+        auto query = connectionRef.select(sql, {2}, true);
+
+        QVERIFY(query.isForwardOnly());
+        QVERIFY(query.next());
+        QCOMPARE(query.value(NAME), QVariant(QStringLiteral("test2")));
+        QVERIFY(!query.next());
+    }
+    // Same mode
+    {
+        auto query = connectionRef.select(sql, {3}, true);
+
+        QVERIFY(query.isForwardOnly());
+        QVERIFY(query.next());
+        QCOMPARE(query.value(NAME), QVariant(QStringLiteral("test3")));
+        QVERIFY(!query.next());
+    }
+
+    const auto &counter = connectionRef.getPreparedStatementsCacheCounter();
+
+    QCOMPARE(counter.hits, 1);
+    QCOMPARE(counter.misses, 2);
+
+    connectionRef.disablePreparedStatementsCache();
+}
+
+void tst_DatabaseConnection::connectElapsed_CountedOnReconnect() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.connectEagerly();
+
+    const auto connectsCount = connectionRef.getConnectsCount();
+
+    QVERIFY(connectsCount > 0);
+    QVERIFY(connectionRef.getConnectElapsed() >= 0);
+
+    connectionRef.disconnect();
+    connectionRef.connectEagerly();
+
+    QCOMPARE(connectionRef.getConnectsCount(), connectsCount + 1);
+    QVERIFY(connectionRef.getConnectElapsed() >= 0);
+}
+
+void tst_DatabaseConnection::latencyHistograms_Fingerprint() const
+{
+    QCOMPARE(QueryUtils::fingerprint(
+                 "select *  from \"torrents\"\n where id in (?, ?, ?) and name = 'it''s' "
+                 "limit 10"),
+             QStringLiteral(
+                 "select * from \"torrents\" where id in (?) and name = ? limit ?"));
+
+    QCOMPARE(QueryUtils::fingerprint(
+                 "insert into `torrents` (`name`, `size`) values (?, ?), (?, ?), (?, ?)"),
+             QStringLiteral(
+                 "insert into `torrents` (`name`, `size`) values (?)"));
+
+    // Numbers inside identifiers are kept
+    QCOMPARE(QueryUtils::fingerprint("select t1.id from t1 where id = 1.5"),
+             QStringLiteral("select t1.id from t1 where id = ?"));
+}
+
+void tst_DatabaseConnection::latencyHistograms_Record() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    QVERIFY(!connectionRef.countingLatencies());
+
+    connectionRef.enableLatencyHistograms();
+
+    for (const auto id : {1, 2, 3})
+        std::ignore = connectionRef.scalar(
+                          QStringLiteral("select name from torrents where id = %1")
+                          .arg(id));
+
+    connectionRef.beginTransaction();
+    connectionRef.rollBack();
+
+    const auto statements = connectionRef.takeLatencyHistograms();
+
+    // One fingerprint for all selects and two transactional statements
+    QCOMPARE(statements.size(), static_cast<std::size_t>(3));
+
+    const auto itSelect = std::ranges::find(statements, StatementType::Select,
+                                            &Orm::StatementLatency::type);
+    QVERIFY(itSelect != statements.cend());
+
+    QCOMPARE(itSelect->fingerprint,
+             QStringLiteral("select name from torrents where id = ?"));
+    QCOMPARE(itSelect->count, 3);
+    QCOMPARE(itSelect->buckets.size(), LatencyHistograms::BucketsCount);
+    QVERIFY(itSelect->p50 <= itSelect->p99);
+    QVERIFY(itSelect->p99 <= itSelect->maxTime);
+
+    QVERIFY(connectionRef.getLatencyHistograms().empty());
+
+    connectionRef.disableLatencyHistograms();
+    QVERIFY(!connectionRef.countingLatencies());
+}
+
+void tst_DatabaseConnection::queryLog_Bounded() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    connectionRef.flushQueryLog();
+    connectionRef.enableQueryLog(2);
+    QCOMPARE(connectionRef.getQueryLogMaxSize(), static_cast<std::size_t>(2));
+
+    for (const auto id : {1, 2, 3})
+        std::ignore = connectionRef.scalar("select name from torrents where id = ?",
+                                           {id});
+
+    // Only the two most recent queries in the executed order
+    const auto queryLog = connectionRef.getQueryLog();
+
+    QCOMPARE(queryLog->size(), 2);
+    QCOMPARE(queryLog->at(0).boundValues, QVector<QVariant>({2}));
+    QCOMPARE(queryLog->at(1).boundValues, QVector<QVariant>({3}));
+
+    // Restore (unbounded)
+    connectionRef.enableQueryLog();
+    connectionRef.disableQueryLog();
+    connectionRef.flushQueryLog();
+}
+
+void tst_DatabaseConnection::queryAnalyzer_NPlusOne() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connectionRef = DB::connection(connection);
+
+    QVector<QueryIssue> issues;
+
+    connectionRef.enableQueryAnalyzer([&issues](const QueryIssue &issue)
+    {
+        issues << issue;
+    },
+        0, 3);
+    QVERIFY(connectionRef.analyzingQueries());
+
+    // The same query with the same bindings isn't the N+1 problem
+    for (const auto id : {1, 1, 1})
+        std::ignore = connectionRef.scalar("select name from torrents where id = ?",
+                                           {id});
+    QVERIFY(issues.isEmpty());
+
+    // Reported only once
+    for (const auto id : {2, 3, 4, 5})
+        std::ignore = connectionRef.scalar("select name from torrents where id = ?",
+                                           {id});
+
+    QCOMPARE(issues.size(), 1);
+
+    const auto &issue = issues.constFirst();
+    QCOMPARE(issue.type, QueryIssue::Type::N_PLUS_ONE);
+    QCOMPARE(issue.connection, connection);
+    QCOMPARE(issue.fingerprint,
+             QStringLiteral("select name from torrents where id = ?"));
+    QCOMPARE(issue.boundValues, QVector<QVariant>({3}));
+    QCOMPARE(issue.count, 3);
+
+    connectionRef.disableQueryAnalyzer();
+    QVERIFY(!connectionRef.analyzingQueries());
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
@@ -110,6 +110,7 @@ private Q_SLOTS:
 
     void selectRaw() const;
     void selectRaw_WithBindings_WithWhere() const;
+    void getBindings_OrderedByBindingType() const;
 
     void selectSub_QStringOverload() const;
     void selectSub_QueryBuilderOverload_WithWhere() const;
@@ -924,6 +925,35 @@ void tst_MySql_QueryBuilder::selectRaw_WithBindings_WithWhere() const
              QVector<QVariant>({QVariant(10), QVariant(1520652582)}));
 }
 
+void tst_MySql_QueryBuilder::getBindings_OrderedByBindingType() const
+{
+    auto builder = createQuery();
+
+    // Bindings are added in a different order than they are compiled
+    builder->from("torrents")
+            .orderByRaw("field(`id`, ?, ?)", {3, 1})
+            .where(SIZE_, GT, 10)
+            .havingRaw("sum(`size`) > ?", {100})
+            .selectRaw("`name`, ? as `type`", {"torrent"})
+            .where(Progress, LT, 20);
+
+    QCOMPARE(builder->toSql(),
+             "select `name`, ? as `type` from `torrents` "
+             "where `size` > ? and `progress` < ? "
+             "having sum(`size`) > ? "
+             "order by field(`id`, ?, ?)");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant("torrent"), QVariant(10), QVariant(20),
+                                QVariant(100), QVariant(3), QVariant(1)}));
+
+    // Clearing one binding type keeps the others
+    builder->reorder();
+
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant("torrent"), QVariant(10), QVariant(20),
+                                QVariant(100)}));
+}
+
 void tst_MySql_QueryBuilder::selectSub_QStringOverload() const
 {
     auto builder = createQuery();
@@ -2,6 +2,8 @@
 #include <QtTest>
 
 #include "orm/db.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/query/grammars/postgresgrammar.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -22,7 +24,9 @@ using Orm::Constants::Progress;
 using Orm::Constants::SIZE_;
 
 using Orm::DB;
+using Orm::Exceptions::InvalidArgumentError;
 using Orm::Query::Expression;
+using Orm::Query::Grammars::PostgresGrammar;
 
 using QueryBuilder = Orm::Query::Builder;
 using Raw = Orm::Query::Expression;
@@ -110,6 +114,9 @@ private Q_SLOTS:
     void whereIn_Empty() const;
     void whereNotIn_Empty() const;
     void whereIn_ValueExpression() const;
+    void whereIn_AsArray() const;
+    void whereIn_AsArray_ValueExpression() const;
+    void whereIn_AsArray_SameShapeExpanded() const;
 
     void whereNull() const;
     void whereNotNull() const;
@@ -136,9 +143,14 @@ private Q_SLOTS:
 
     void insert() const;
     void insert_WithExpression() const;
+    void insertGetIds() const;
 
     void update() const;
     void update_WithExpression() const;
+    void updateBatch() const;
+    void updateBatch_WithWheres() const;
+    void updateBatch_WithoutUniqueColumn_ThrowException() const;
+    void updateBatch_WithJoin_ThrowException() const;
 
     void upsert() const;
     void upsert_WithoutUpdate_UpdateAll() const;
@@ -1523,6 +1535,105 @@ void tst_PostgreSQL_QueryBuilder::whereIn_ValueExpression() const
     }
 }
 
+void tst_PostgreSQL_QueryBuilder::whereIn_AsArray() const
+{
+    auto &grammar = dynamic_cast<PostgresGrammar &>(
+                        DB::connection(m_connection).getQueryGrammar());
+    grammar.setWhereInAsArray(true);
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {2, 3, 4})
+                .orWhereNotIn(NAME, {"a,b", "c\"d", QVariant()});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = any(?) "
+                   "or \"name\" <> all(?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant("{2,3,4}"),
+                                    QVariant(R"({"a,b","c\"d",NULL})")}));
+    }
+
+    // The same SQL query for any number of values
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {2, 3, 4, 5, 6});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = any(?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant("{2,3,4,5,6}")}));
+    }
+
+    // Empty values are compiled without bindings
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn(ID, {});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where 0 = 1");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>());
+    }
+
+    // Restore
+    grammar.setWhereInAsArray(false);
+}
+
+void tst_PostgreSQL_QueryBuilder::whereIn_AsArray_ValueExpression() const
+{
+    auto &grammar = dynamic_cast<PostgresGrammar &>(
+                        DB::connection(m_connection).getQueryGrammar());
+    grammar.setWhereInAsArray(true);
+
+    // Values containing an expression are bound one by one
+    auto builder = createQuery();
+
+    builder->select("*").from("torrents").whereIn(ID, {1, Raw(2), 3});
+    QCOMPARE(builder->toSql(),
+             "select * from \"torrents\" where \"id\" in (?, 2, ?)");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(3)}));
+
+    // Restore
+    grammar.setWhereInAsArray(false);
+}
+
+void tst_PostgreSQL_QueryBuilder::whereIn_AsArray_SameShapeExpanded() const
+{
+    auto &grammar = dynamic_cast<PostgresGrammar &>(
+                        DB::connection(m_connection).getQueryGrammar());
+    grammar.setWhereInAsArray(true);
+
+    // Values that can be bound as the array
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn("added_on", {1, 2});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"added_on\" = any(?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant("{1,2}")}));
+    }
+
+    // The same query shape with the values that can't be bound as the array
+    {
+        QDate date1(2022, 1, 12);
+        QDate date2(2022, 1, 13);
+
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereIn("added_on", {date1, date2});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"added_on\" in (?, ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(date1), QVariant(date2)}));
+    }
+
+    // Restore
+    grammar.setWhereInAsArray(false);
+}
+
 void tst_PostgreSQL_QueryBuilder::whereNull() const
 {
     {
@@ -1956,6 +2067,26 @@ void tst_PostgreSQL_QueryBuilder::insert_WithExpression() const
              QVector<QVariant>({QVariant(6)}));
 }
 
+void tst_PostgreSQL_QueryBuilder::insertGetIds() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        connection.query()->from("torrents")
+                .insertGetIds({NAME, SIZE_}, {{"xyz", 6}, {"zyx", 7}});
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "insert into \"torrents\" (\"name\", \"size\") values (?, ?), (?, ?) "
+             "returning \"id\"");
+    QCOMPARE(firstLog.boundValues,
+             QVector<QVariant>({QVariant("xyz"), QVariant(6),
+                                QVariant("zyx"), QVariant(7)}));
+}
+
 void tst_PostgreSQL_QueryBuilder::update() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
@@ -2001,6 +2132,68 @@ void tst_PostgreSQL_QueryBuilder::update_WithExpression() const
              QVector<QVariant>({QVariant(6), QVariant(10)}));
 }
 
+void tst_PostgreSQL_QueryBuilder::updateBatch() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        connection.query()->from("torrents")
+                .updateBatch({ID, NAME, SIZE_}, {{1, "xyz", 6}, {2, "zyx", 7}}, ID);
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "update \"torrents\" "
+             "set \"name\" = case \"id\" when ? then ? when ? then ? else \"name\" end, "
+             "\"size\" = case \"id\" when ? then ? when ? then ? else \"size\" end "
+             "where \"id\" in (?, ?)");
+    QCOMPARE(firstLog.boundValues,
+             QVector<QVariant>({QVariant(1), QVariant("xyz"), QVariant(2), QVariant("zyx"),
+                                QVariant(1), QVariant(6),     QVariant(2), QVariant(7),
+                                QVariant(1), QVariant(2)}));
+}
+
+void tst_PostgreSQL_QueryBuilder::updateBatch_WithWheres() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        connection.query()->from("torrents").where(SIZE_, ">", 5).orWhere(NOTE, "abc")
+                .updateBatch({ID, NAME}, {{1, "xyz"}, {2, "zyx"}}, ID);
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "update \"torrents\" "
+             "set \"name\" = case \"id\" when ? then ? when ? then ? else \"name\" end "
+             "where \"id\" in (?, ?) and (\"size\" > ? or \"note\" = ?)");
+    QCOMPARE(firstLog.boundValues,
+             QVector<QVariant>({QVariant(1), QVariant("xyz"), QVariant(2), QVariant("zyx"),
+                                QVariant(1), QVariant(2),
+                                QVariant(5), QVariant("abc")}));
+}
+
+void tst_PostgreSQL_QueryBuilder::updateBatch_WithoutUniqueColumn_ThrowException() const
+{
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents").updateBatch(
+                    {NAME, SIZE_}, {{"xyz", 6}}, ID),
+                InvalidArgumentError);
+}
+
+void tst_PostgreSQL_QueryBuilder::updateBatch_WithJoin_ThrowException() const
+{
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents")
+                .join("torrent_peers", "torrents.id", "=", "torrent_peers.torrent_id")
+                .updateBatch({ID, NAME}, {{1, "xyz"}}, ID),
+                InvalidArgumentError);
+}
+
 void tst_PostgreSQL_QueryBuilder::upsert() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
@@ -2,6 +2,7 @@
 #include <QtTest>
 
 #include "orm/db.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -22,6 +23,7 @@ using Orm::Constants::Progress;
 using Orm::Constants::SIZE_;
 
 using Orm::DB;
+using Orm::Exceptions::InvalidArgumentError;
 using Orm::Query::Expression;
 
 using QueryBuilder = Orm::Query::Builder;
@@ -135,12 +137,16 @@ private Q_SLOTS:
 
     void insert() const;
     void insert_WithExpression() const;
+    void insertBatched() const;
+    void insertBatched_WithExpression() const;
+    void insertBatched_DifferentSize_ThrowException() const;
 
     void update() const;
     void update_WithExpression() const;
 
     void upsert() const;
     void upsert_WithoutUpdate_UpdateAll() const;
+    void upsert_Batched() const;
 
     void remove() const;
     void remove_WithExpression() const;
@@ -1915,6 +1921,62 @@ void tst_SQLite_QueryBuilder::insert_WithExpression() const
              QVector<QVariant>({QVariant(6)}));
 }
 
+void tst_SQLite_QueryBuilder::insertBatched() const
+{
+    // SQLite grammar allows 999 parameters, so 499 rows with 2 columns per statement
+    QVector<QVector<QVariant>> values;
+    values.reserve(1000);
+
+    for (auto i = 0; i < 1000; ++i)
+        values.append({QStringLiteral("xyz%1").arg(i), i});
+
+    auto log = DB::connection(m_connection).pretend([&values](auto &connection)
+    {
+        connection.query()->from("torrents").insertBatched({NAME, SIZE_}, values);
+    });
+
+    QCOMPARE(log.size(), 3);
+    QCOMPARE(log.at(0).boundValues.size(), 998);
+    QCOMPARE(log.at(1).boundValues.size(), 998);
+
+    const auto &lastLog = log.constLast();
+
+    QCOMPARE(lastLog.query,
+             "insert into \"torrents\" (\"name\", \"size\") values (?, ?), (?, ?)");
+    QCOMPARE(lastLog.boundValues,
+             QVector<QVariant>({QVariant("xyz998"), QVariant(998),
+                                QVariant("xyz999"), QVariant(999)}));
+}
+
+void tst_SQLite_QueryBuilder::insertBatched_WithExpression() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        connection.query()->from("torrents").insertBatched(
+                    {NAME, SIZE_}, {{"xyz", 6}, {"zyx", DB::raw(7)}});
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "insert into \"torrents\" (\"name\", \"size\") values (?, ?), (?, 7)");
+    QCOMPARE(firstLog.boundValues,
+             QVector<QVariant>({QVariant("xyz"), QVariant(6), QVariant("zyx")}));
+}
+
+void tst_SQLite_QueryBuilder::insertBatched_DifferentSize_ThrowException() const
+{
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents").insertBatched(
+                    {NAME, SIZE_}, {{"xyz", 6}, {"zyx"}}),
+                InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->from("torrents").insertBatched({}, {{"xyz", 6}}),
+                InvalidArgumentError);
+}
+
 void tst_SQLite_QueryBuilder::update() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
@@ -2011,6 +2073,36 @@ void tst_SQLite_QueryBuilder::upsert_WithoutUpdate_UpdateAll() const
                                 QVariant(QString("purple")), QVariant(4), QVariant(1)}));
 }
 
+void tst_SQLite_QueryBuilder::upsert_Batched() const
+{
+    // SQLite grammar allows 999 parameters, so 333 rows with 3 columns per statement
+    QVector<QVariantMap> values;
+    values.reserve(500);
+
+    for (auto i = 0; i < 500; ++i)
+        values.append({{"tag_id", 1}, {"color", "pink"}, {"position", i}});
+
+    auto log = DB::connection(m_connection).pretend([&values](auto &connection)
+    {
+        connection.query()->from("tag_properties")
+                .upsert(values, {"position"}, {"color"});
+    });
+
+    QCOMPARE(log.size(), 2);
+    QCOMPARE(log.at(0).boundValues.size(), 999);
+    QCOMPARE(log.at(1).boundValues.size(), 501);
+
+    const auto &lastLog = log.constLast();
+
+    QVERIFY(lastLog.query.startsWith(
+                "insert into \"tag_properties\" (\"color\", \"position\", "
+                "\"tag_id\") values (?, ?, ?), (?, ?, ?)"));
+    QVERIFY(lastLog.query.endsWith(
+                "on conflict (\"position\") "
+                "do update set \"color\" = \"excluded\".\"color\""));
+    QCOMPARE(lastLog.boundValues.at(1), QVariant(333));
+}
+
 void tst_SQLite_QueryBuilder::remove() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
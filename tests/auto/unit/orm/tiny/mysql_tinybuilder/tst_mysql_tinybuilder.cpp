@@ -111,6 +111,9 @@ private Q_SLOTS:
     void deletedAt_Column_WithoutJoins() const;
     void deletedAt_Column_WithJoins() const;
 
+    /* TinyBuilder methods */
+    void clone_DoesntShareQueryBuilder() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Create TinyBuilder instance for the given connection. */
@@ -1237,6 +1240,28 @@ void tst_MySql_TinyBuilder::deletedAt_Column_WithJoins() const
              "where `users`.`id` = ? and `users`.`deleted_at` is null");
     QCOMPARE(firstLog.boundValues.size(), 3);
 }
+
+/* TinyBuilder methods */
+
+void tst_MySql_TinyBuilder::clone_DoesntShareQueryBuilder() const
+{
+    auto builder = createTinyQuery<Torrent>();
+
+    builder->whereEq(SIZE_, 10);
+
+    auto clone = builder->clone();
+
+    clone.forPageAfterId(5, 3);
+
+    QCOMPARE(clone.toSql(),
+             "select * from `torrents` where `size` = ? and `id` > ? "
+             "order by `id` asc limit 5");
+    QCOMPARE(clone.getBindings(), QVector<QVariant>({QVariant(10), QVariant(3)}));
+
+    // The original query is untouched
+    QCOMPARE(builder->toSql(), "select * from `torrents` where `size` = ?");
+    QCOMPARE(builder->getBindings(), QVector<QVariant>({QVariant(10)}));
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
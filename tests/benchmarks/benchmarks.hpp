@@ -0,0 +1,25 @@
+#pragma once
+#ifndef BENCHMARKS_BENCHMARKS_HPP
+#define BENCHMARKS_BENCHMARKS_HPP
+
+namespace Benchmarks
+{
+namespace Support
+{
+    class Runner;
+}
+
+    /*! Register the Grammar and QueryBuilder benchmarks. */
+    void registerQueryBuilderBenchmarks(Support::Runner &runner);
+    /*! Register the Builder<Model> hydration benchmarks. */
+    void registerTinyBuilderBenchmarks(Support::Runner &runner);
+    /*! Register the eager loading benchmarks. */
+    void registerRelationsBenchmarks(Support::Runner &runner);
+    /*! Register the Model::save() and Model::push() benchmarks. */
+    void registerModelBenchmarks(Support::Runner &runner);
+    /*! Register the ModelsCollection and serialization benchmarks. */
+    void registerCollectionBenchmarks(Support::Runner &runner);
+
+} // namespace Benchmarks
+
+#endif // BENCHMARKS_BENCHMARKS_HPP
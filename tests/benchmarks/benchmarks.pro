@@ -0,0 +1,25 @@
+include($$TINYORM_SOURCE_TREE/tests/qmake/common.pri)
+
+# Benchmarks are run manually (with the --min-time and --json options), don't run
+# them during the make check
+CONFIG -= testcase
+
+INCLUDEPATH += $$PWD
+
+HEADERS += \
+    $$PWD/benchmarks.hpp \
+    $$PWD/models/author.hpp \
+    $$PWD/models/post.hpp \
+    $$PWD/models/tag.hpp \
+    $$PWD/support/benchmark.hpp \
+    $$PWD/support/database.hpp \
+
+SOURCES += \
+    $$PWD/collection.cpp \
+    $$PWD/main.cpp \
+    $$PWD/model.cpp \
+    $$PWD/querybuilder.cpp \
+    $$PWD/relations.cpp \
+    $$PWD/support/benchmark.cpp \
+    $$PWD/support/database.cpp \
+    $$PWD/tinybuilder.cpp \
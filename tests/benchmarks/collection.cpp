@@ -0,0 +1,100 @@
+#include "benchmarks.hpp"
+#include "support/benchmark.hpp"
+
+#include "models/author.hpp"
+#include "models/post.hpp"
+
+using Orm::Constants::GT;
+using Orm::Constants::ID;
+
+using Benchmarks::Models::Author;
+using Benchmarks::Models::Post;
+using Benchmarks::Support::Runner;
+using Benchmarks::Support::State;
+using Benchmarks::Support::doNotOptimize;
+
+namespace Benchmarks
+{
+
+void registerCollectionBenchmarks(Runner &runner)
+{
+    /* ModelsCollection operations, the collection is hydrated once before
+       the measured loop. */
+
+    runner.add("ModelsCollection/modelKeys", [](State &state)
+    {
+        const auto posts = Post::all();
+
+        while (state.keepRunning())
+            doNotOptimize(posts.modelKeys());
+    });
+
+    runner.add("ModelsCollection/pluck", [](State &state)
+    {
+        const auto posts = Post::all();
+
+        while (state.keepRunning())
+            doNotOptimize(posts.pluck("title"));
+    });
+
+    runner.add("ModelsCollection/where", [](State &state)
+    {
+        auto posts = Post::all();
+
+        while (state.keepRunning())
+            doNotOptimize(posts.where("votes", GT, 50));
+    });
+
+    runner.add("ModelsCollection/filter", [](State &state)
+    {
+        auto posts = Post::all();
+
+        while (state.keepRunning())
+            doNotOptimize(posts.filter([](Post *const post)
+            {
+                return post->getAttribute("is_published").value<bool>();
+            }));
+    });
+
+    runner.add("ModelsCollection/sortBy", [](State &state)
+    {
+        auto posts = Post::all();
+
+        while (state.keepRunning())
+            doNotOptimize(posts.sortBy<int>("votes"));
+    });
+
+    runner.add("ModelsCollection/find", [](State &state)
+    {
+        auto posts = Post::all();
+        const auto size = static_cast<quint64>(posts.size());
+        quint64 id = 0;
+
+        while (state.keepRunning())
+            doNotOptimize(posts.find((id++ % size) + 1));
+    });
+
+    // Serialization
+
+    runner.add("Serialization/toJson/posts", [](State &state)
+    {
+        const auto posts = Post::all();
+
+        while (state.keepRunning())
+            doNotOptimize(posts.toJson());
+
+        state.setItemsProcessed(state.iterations() * posts.size());
+    });
+
+    runner.add("Serialization/toJson/authors.posts", [](State &state)
+    {
+        const auto authors = Author::with("posts")->orderBy(ID).get();
+
+        while (state.keepRunning())
+            doNotOptimize(authors.toJson());
+
+        state.setItemsProcessed(state.iterations() * authors.size());
+    });
+}
+
+} // namespace Benchmarks
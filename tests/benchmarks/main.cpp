@@ -0,0 +1,26 @@
+#include <QCoreApplication>
+
+#include "benchmarks.hpp"
+#include "support/benchmark.hpp"
+#include "support/database.hpp"
+
+using Benchmarks::Support::Database;
+using Benchmarks::Support::Runner;
+
+int main(int argc, char *argv[])
+{
+    const QCoreApplication app(argc, argv);
+
+    // Temporary SQLite database with the benchmarks schema and seeded data
+    const Database database;
+
+    Runner runner;
+
+    Benchmarks::registerQueryBuilderBenchmarks(runner);
+    Benchmarks::registerTinyBuilderBenchmarks(runner);
+    Benchmarks::registerRelationsBenchmarks(runner);
+    Benchmarks::registerModelBenchmarks(runner);
+    Benchmarks::registerCollectionBenchmarks(runner);
+
+    return runner.run(QCoreApplication::arguments());
+}
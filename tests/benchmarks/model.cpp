@@ -0,0 +1,87 @@
+#include "orm/db.hpp"
+
+#include "benchmarks.hpp"
+#include "support/benchmark.hpp"
+
+#include "models/author.hpp"
+#include "models/post.hpp"
+
+using Orm::DB;
+
+using Benchmarks::Models::Author;
+using Benchmarks::Models::Post;
+using Benchmarks::Support::Runner;
+using Benchmarks::Support::State;
+using Benchmarks::Support::doNotOptimize;
+
+namespace Benchmarks
+{
+
+void registerModelBenchmarks(Runner &runner)
+{
+    /* All benchmarks that modify the database are rolled back so they don't
+       affect other benchmarks. */
+
+    runner.add("Model/save/insert", [](State &state)
+    {
+        DB::beginTransaction();
+
+        while (state.keepRunning()) {
+            Post post({
+                {"title",        "benchmark post"},
+                {"slug",         "benchmark-post"},
+                {"excerpt",      "benchmark excerpt"},
+                {"body",         "benchmark body"},
+                {"status",       "draft"},
+                {"language",     "en"},
+                {"votes",        0},
+                {"words",        2},
+                {"views",        0},
+                {"score",        0.0},
+                {"is_published", false},
+            });
+            post.setAttribute("author_id", 1);
+
+            doNotOptimize(post.save());
+        }
+
+        DB::rollBack();
+    });
+
+    runner.add("Model/save/update", [](State &state)
+    {
+        DB::beginTransaction();
+
+        auto post = Post::findOrFail(1);
+        qint64 votes = 0;
+
+        while (state.keepRunning()) {
+            post.setAttribute("votes", ++votes);
+
+            doNotOptimize(post.save());
+        }
+
+        DB::rollBack();
+    });
+
+    runner.add("Model/push/author.posts", [](State &state)
+    {
+        DB::beginTransaction();
+
+        auto author = Author::with("posts")->findOrFail(1);
+        qint64 votes = 0;
+
+        while (state.keepRunning()) {
+            ++votes;
+
+            for (auto *const post : author.getRelation<Post>("posts"))
+                post->setAttribute("votes", votes);
+
+            doNotOptimize(author.push());
+        }
+
+        DB::rollBack();
+    });
+}
+
+} // namespace Benchmarks
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef BENCHMARKS_MODELS_AUTHOR_HPP
+#define BENCHMARKS_MODELS_AUTHOR_HPP
+
+#include "orm/tiny/model.hpp"
+
+#include "models/post.hpp"
+
+namespace Benchmarks::Models
+{
+
+using Orm::Constants::NAME;
+
+using Orm::Tiny::Model;
+
+class Post;
+
+// NOLINTNEXTLINE(misc-no-recursion, bugprone-exception-escape)
+class Author final : public Model<Author, Post>
+{
+    friend Model;
+    using Model::Model;
+
+public:
+    /*! Get posts written by the author. */
+    std::unique_ptr<HasMany<Author, Post>>
+    posts()
+    {
+        return hasMany<Post>();
+    }
+
+private:
+    /*! Map of relation names to methods. */
+    inline static const QHash<QString, RelationVisitor> u_relations {
+        {"posts", [](auto &v) { v(&Author::posts); }},
+    };
+
+    /*! The attributes that are mass assignable. */
+    inline static const QStringList u_fillable { // NOLINT(cppcoreguidelines-interfaces-global-init)
+        NAME,
+        "email",
+    };
+};
+
+} // namespace Benchmarks::Models
+
+#endif // BENCHMARKS_MODELS_AUTHOR_HPP
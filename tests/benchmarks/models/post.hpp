@@ -0,0 +1,72 @@
+#pragma once
+#ifndef BENCHMARKS_MODELS_POST_HPP
+#define BENCHMARKS_MODELS_POST_HPP
+
+#include "orm/tiny/model.hpp"
+#include "orm/tiny/relations/pivot.hpp"
+
+#include "models/author.hpp"
+#include "models/tag.hpp"
+
+namespace Benchmarks::Models
+{
+
+using Orm::Tiny::Model;
+using Orm::Tiny::Relations::Pivot;
+
+class Author;
+
+// NOLINTNEXTLINE(misc-no-recursion, bugprone-exception-escape)
+class Post final : public Model<Post, Author, Tag, Pivot>
+{
+    friend Model;
+    using Model::Model;
+
+public:
+    /*! Get the author that wrote the post. */
+    std::unique_ptr<BelongsTo<Post, Author>>
+    author()
+    {
+        return belongsTo<Author>();
+    }
+
+    /*! Get tags that belong to the post. */
+    std::unique_ptr<BelongsToMany<Post, Tag>>
+    tags()
+    {
+        return belongsToMany<Tag>();
+    }
+
+private:
+    /*! Map of relation names to methods. */
+    inline static const QHash<QString, RelationVisitor> u_relations {
+        {"author", [](auto &v) { v(&Post::author); }},
+        {"tags",   [](auto &v) { v(&Post::tags); }},
+    };
+
+    /*! The attributes that are mass assignable. */
+    inline static const QStringList u_fillable { // NOLINT(cppcoreguidelines-interfaces-global-init)
+        "title",
+        "slug",
+        "excerpt",
+        "body",
+        "status",
+        "language",
+        "votes",
+        "words",
+        "views",
+        "score",
+        "is_published",
+        "published_at",
+        "note",
+    };
+
+    /*! The attributes that should be mutated to dates. */
+    inline static const QStringList u_dates { // NOLINT(cppcoreguidelines-interfaces-global-init)
+        "published_at",
+    };
+};
+
+} // namespace Benchmarks::Models
+
+#endif // BENCHMARKS_MODELS_POST_HPP
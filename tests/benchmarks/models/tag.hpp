@@ -0,0 +1,28 @@
+#pragma once
+#ifndef BENCHMARKS_MODELS_TAG_HPP
+#define BENCHMARKS_MODELS_TAG_HPP
+
+#include "orm/tiny/model.hpp"
+
+namespace Benchmarks::Models
+{
+
+using Orm::Constants::NAME;
+
+using Orm::Tiny::Model;
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+class Tag final : public Model<Tag>
+{
+    friend Model;
+    using Model::Model;
+
+    /*! The attributes that are mass assignable. */
+    inline static const QStringList u_fillable { // NOLINT(cppcoreguidelines-interfaces-global-init)
+        NAME,
+    };
+};
+
+} // namespace Benchmarks::Models
+
+#endif // BENCHMARKS_MODELS_TAG_HPP
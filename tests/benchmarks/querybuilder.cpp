@@ -0,0 +1,78 @@
+#include "orm/db.hpp"
+
+#include "benchmarks.hpp"
+#include "support/benchmark.hpp"
+
+using Orm::Constants::ASC;
+using Orm::Constants::DESC;
+using Orm::Constants::GT;
+using Orm::Constants::ID;
+using Orm::Constants::LIKE;
+using Orm::Constants::NAME;
+
+using Orm::DB;
+
+using Benchmarks::Support::Runner;
+using Benchmarks::Support::State;
+using Benchmarks::Support::doNotOptimize;
+
+namespace Benchmarks
+{
+
+void registerQueryBuilderBenchmarks(Runner &runner)
+{
+    runner.add("QueryBuilder/construct", [](State &state)
+    {
+        while (state.keepRunning())
+            doNotOptimize(DB::query());
+    });
+
+    runner.add("QueryBuilder/construct_with_wheres", [](State &state)
+    {
+        while (state.keepRunning()) {
+            auto query = DB::table("posts");
+
+            query->where("votes", GT, 10)
+                   .whereIn("status", {"draft", "published"})
+                   .orderBy(ID, DESC)
+                   .limit(10);
+
+            doNotOptimize(query);
+        }
+    });
+
+    runner.add("Grammar/compileSelect/simple", [](State &state)
+    {
+        auto query = DB::table("posts");
+        query->where("votes", GT, 10).orderBy(ID, ASC).limit(10);
+
+        while (state.keepRunning())
+            doNotOptimize(query->toSql());
+    });
+
+    runner.add("Grammar/compileSelect/complex", [](State &state)
+    {
+        auto query = DB::table("posts");
+
+        query->select({"posts.id", "posts.title", "authors.name"})
+               .join("authors", "posts.author_id", "=", "authors.id")
+               .where("posts.votes", GT, 10)
+               .where([](auto &nested)
+               {
+                   nested.where("posts.status", "=", "published")
+                         .orWhere("posts.title", LIKE, "%post%");
+               })
+               .whereIn("posts.language", {"en", "de", "sk"})
+               .whereNotNull("posts.published_at")
+               .groupBy({"posts.id", "posts.title", "authors.name"})
+               .having("posts.id", GT, 100)
+               .orderBy(NAME, DESC)
+               .limit(50)
+               .offset(100);
+
+        while (state.keepRunning())
+            doNotOptimize(query->toSql());
+    });
+}
+
+} // namespace Benchmarks
@@ -0,0 +1,77 @@
+#include "benchmarks.hpp"
+#include "support/benchmark.hpp"
+
+#include "models/author.hpp"
+#include "models/post.hpp"
+
+using Benchmarks::Models::Author;
+using Benchmarks::Models::Post;
+using Benchmarks::Support::Runner;
+using Benchmarks::Support::State;
+using Benchmarks::Support::doNotOptimize;
+
+namespace Benchmarks
+{
+
+void registerRelationsBenchmarks(Runner &runner)
+{
+    // Items processed are the parent models the relations were matched to
+
+    runner.add("EagerLoad/HasMany/authors.posts", [](State &state)
+    {
+        qint64 models = 0;
+
+        while (state.keepRunning()) {
+            auto authors = Author::with("posts")->get();
+
+            models += authors.size();
+            doNotOptimize(authors);
+        }
+
+        state.setItemsProcessed(models);
+    });
+
+    runner.add("EagerLoad/BelongsTo/posts.author", [](State &state)
+    {
+        qint64 models = 0;
+
+        while (state.keepRunning()) {
+            auto posts = Post::with("author")->get();
+
+            models += posts.size();
+            doNotOptimize(posts);
+        }
+
+        state.setItemsProcessed(models);
+    });
+
+    runner.add("EagerLoad/BelongsToMany/posts.tags", [](State &state)
+    {
+        qint64 models = 0;
+
+        while (state.keepRunning()) {
+            auto posts = Post::with("tags")->get();
+
+            models += posts.size();
+            doNotOptimize(posts);
+        }
+
+        state.setItemsProcessed(models);
+    });
+
+    runner.add("EagerLoad/Nested/authors.posts.tags", [](State &state)
+    {
+        qint64 models = 0;
+
+        while (state.keepRunning()) {
+            auto authors = Author::with("posts.tags")->get();
+
+            models += authors.size();
+            doNotOptimize(authors);
+        }
+
+        state.setItemsProcessed(models);
+    });
+}
+
+} // namespace Benchmarks
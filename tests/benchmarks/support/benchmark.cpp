@@ -0,0 +1,283 @@
+#include "support/benchmark.hpp"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QSysInfo>
+#include <QThread>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <utility>
+
+#include "orm/version.hpp"
+
+namespace Benchmarks::Support
+{
+
+namespace
+{
+    /*! Maximum number of iterations for one benchmark. */
+    constexpr qint64 MaxIterations = 1'000'000'000;
+
+    /*! Convert the clock ticks to nanoseconds. */
+    qint64 clockToNanoseconds(const std::clock_t ticks)
+    {
+        return static_cast<qint64>(static_cast<double>(ticks) * 1e9 / CLOCKS_PER_SEC);
+    }
+} // namespace
+
+/* State */
+
+/* public */
+
+State::State(const qint64 iterations)
+    : m_iterations(iterations)
+    , m_remaining(iterations)
+{}
+
+bool State::keepRunning()
+{
+    // Start the timer before the first iteration
+    if (!m_started) {
+        m_started = true;
+
+        resumeTiming();
+    }
+
+    if (m_remaining > 0) {
+        --m_remaining;
+        return true;
+    }
+
+    // Stop the timer after the last iteration
+    if (m_running)
+        pauseTiming();
+
+    return false;
+}
+
+void State::pauseTiming()
+{
+    Q_ASSERT(m_running);
+
+    m_realTime += m_timer.nsecsElapsed();
+    m_cpuTime += clockToNanoseconds(std::clock() - m_cpuStart);
+
+    m_running = false;
+}
+
+void State::resumeTiming()
+{
+    Q_ASSERT(!m_running);
+
+    m_running = true;
+
+    m_cpuStart = std::clock();
+    m_timer.start();
+}
+
+/* Runner */
+
+/* public */
+
+Runner &Runner::add(const QString &name, BenchmarkCallback &&callback)
+{
+    m_benchmarks.append({name, std::move(callback)});
+
+    return *this;
+}
+
+int Runner::run(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                QStringLiteral("TinyORM micro and macro benchmarks."));
+    parser.addHelpOption();
+    parser.addOptions({
+        {QStringLiteral("filter"),
+         QStringLiteral("Run only benchmarks matching the regular expression."),
+         QStringLiteral("regex")},
+        {QStringLiteral("min-time"),
+         QStringLiteral("Minimum time in seconds to run every benchmark "
+                        "(0 runs one iteration, default 0.5)."),
+         QStringLiteral("seconds"), QStringLiteral("0.5")},
+        {QStringLiteral("json"),
+         QStringLiteral("Write results to the JSON file (Google Benchmark format)."),
+         QStringLiteral("filepath")},
+        {QStringLiteral("list"),
+         QStringLiteral("List all benchmarks and exit.")},
+    });
+
+    parser.process(arguments);
+
+    const QRegularExpression filter(parser.value(QStringLiteral("filter")));
+    if (!filter.isValid()) {
+        std::cerr << "Invalid --filter regular expression: "
+                  << filter.errorString().toStdString() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    bool minTimeOk = false;
+    const auto minTime = parser.value(QStringLiteral("min-time")).toDouble(&minTimeOk);
+    if (!minTimeOk || minTime < 0) {
+        std::cerr << "Invalid --min-time value, it must be a non-negative number."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto listOnly = parser.isSet(QStringLiteral("list"));
+
+    QVector<BenchmarkResult> results;
+    results.reserve(m_benchmarks.size());
+
+    for (const auto &benchmark : std::as_const(m_benchmarks)) {
+        if (!filter.match(benchmark.name).hasMatch())
+            continue;
+
+        if (listOnly) {
+            std::cout << benchmark.name.toStdString() << std::endl;
+            continue;
+        }
+
+        results << runBenchmark(benchmark, minTime);
+
+        printResult(results.constLast());
+    }
+
+    if (const auto jsonFilepath = parser.value(QStringLiteral("json"));
+        !listOnly && !jsonFilepath.isEmpty() && !writeJson(jsonFilepath, results)
+    ) {
+        std::cerr << "Can't write the JSON report to '"
+                  << jsonFilepath.toStdString() << "'." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* private */
+
+BenchmarkResult Runner::runBenchmark(const Benchmark &benchmark, const double minTime)
+{
+    qint64 iterations = 1;
+
+    while (true) {
+        State state(iterations);
+
+        std::invoke(benchmark.callback, state);
+
+        /* The minimum time was reached (or only one iteration was requested),
+           the last run is the reported result. */
+        if (const auto realTime = state.realTime();
+            minTime == 0 || iterations >= MaxIterations ||
+            static_cast<double>(realTime) >= minTime * 1e9
+        ) {
+            const auto iterationsDouble = static_cast<double>(iterations);
+
+            std::optional<double> itemsPerSecond;
+            if (const auto items = state.itemsProcessed(); items && realTime > 0)
+                itemsPerSecond = static_cast<double>(*items) * 1e9 /
+                                 static_cast<double>(realTime);
+
+            return {benchmark.name, iterations,
+                    static_cast<double>(realTime) / iterationsDouble,
+                    static_cast<double>(state.cpuTime()) / iterationsDouble,
+                    itemsPerSecond};
+        }
+
+        iterations = predictIterations(iterations, state.realTime(), minTime);
+    }
+}
+
+qint64 Runner::predictIterations(const qint64 iterations, const qint64 realTime,
+                                 const double minTime)
+{
+    /* The same heuristic as the Google Benchmark uses, overshoot the minimum time
+       by 40% and don't grow more than 10 times at once (the first iterations are
+       usually slower). */
+    const auto multiplier = static_cast<double>(realTime) <= 0
+                            ? 10.0
+                            : std::min(10.0, minTime * 1e9 * 1.4 /
+                                             static_cast<double>(realTime));
+
+    const auto predicted = static_cast<qint64>(
+                               std::ceil(static_cast<double>(iterations) * multiplier));
+
+    return std::clamp(predicted, iterations + 1, MaxIterations);
+}
+
+void Runner::printResult(const BenchmarkResult &result)
+{
+    auto line = QStringLiteral("%1 %2 ns %3 ns %4")
+                .arg(result.name, -60)
+                .arg(result.realTime, 14, 'f', 0)
+                .arg(result.cpuTime, 14, 'f', 0)
+                .arg(result.iterations, 12);
+
+    if (result.itemsPerSecond)
+        line += QStringLiteral(" items_per_second=%1/s")
+                .arg(*result.itemsPerSecond, 0, 'f', 0);
+
+    std::cout << line.toStdString() << std::endl;
+}
+
+bool Runner::writeJson(const QString &filepath, const QVector<BenchmarkResult> &results)
+{
+    QJsonArray benchmarks;
+
+    for (const auto &result : results) {
+        QJsonObject benchmark {
+            {QStringLiteral("name"),        result.name},
+            {QStringLiteral("run_name"),    result.name},
+            {QStringLiteral("run_type"),    QStringLiteral("iteration")},
+            {QStringLiteral("repetitions"), 1},
+            {QStringLiteral("iterations"),  result.iterations},
+            {QStringLiteral("real_time"),   result.realTime},
+            {QStringLiteral("cpu_time"),    result.cpuTime},
+            {QStringLiteral("time_unit"),   QStringLiteral("ns")},
+        };
+
+        if (result.itemsPerSecond)
+            benchmark.insert(QStringLiteral("items_per_second"), *result.itemsPerSecond);
+
+        benchmarks.append(benchmark);
+    }
+
+    QFile file(filepath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+
+    const QJsonObject report {
+        {QStringLiteral("context"),    jsonContext()},
+        {QStringLiteral("benchmarks"), benchmarks},
+    };
+
+    return file.write(QJsonDocument(report).toJson()) != -1;
+}
+
+QJsonObject Runner::jsonContext()
+{
+    return {
+        {QStringLiteral("date"),
+         QDateTime::currentDateTime().toString(Qt::ISODate)},
+        {QStringLiteral("host_name"),          QSysInfo::machineHostName()},
+        {QStringLiteral("executable"),         QCoreApplication::applicationFilePath()},
+        {QStringLiteral("num_cpus"),           QThread::idealThreadCount()},
+#ifdef QT_DEBUG
+        {QStringLiteral("library_build_type"), QStringLiteral("debug")},
+#else
+        {QStringLiteral("library_build_type"), QStringLiteral("release")},
+#endif
+        {QStringLiteral("tinyorm_version"),    QString::fromLatin1(TINYORM_VERSION_STR)},
+        {QStringLiteral("qt_version"),         QString::fromLatin1(qVersion())},
+    };
+}
+
+} // namespace Benchmarks::Support
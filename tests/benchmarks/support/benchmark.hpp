@@ -0,0 +1,181 @@
+#pragma once
+#ifndef BENCHMARKS_SUPPORT_BENCHMARK_HPP
+#define BENCHMARKS_SUPPORT_BENCHMARK_HPP
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QVector>
+
+#include <ctime>
+#include <functional>
+#include <optional>
+
+class QJsonObject;
+
+namespace Benchmarks::Support
+{
+
+    /*! Benchmark state passed to every benchmark callback, it controls the number
+        of iterations and measures the time (the same API as the Google Benchmark's
+        KeepRunning() loop, the code outside of the loop isn't measured). */
+    class State
+    {
+        Q_DISABLE_COPY_MOVE(State)
+
+    public:
+        /*! Constructor. */
+        explicit State(qint64 iterations);
+        /*! Default destructor. */
+        inline ~State() = default;
+
+        /*! Determine whether the next iteration should run, starts the timer before
+            the first iteration and stops it after the last one. */
+        bool keepRunning();
+
+        /*! Pause the timer (eg. to prepare data for the next iteration). */
+        void pauseTiming();
+        /*! Resume the paused timer. */
+        void resumeTiming();
+
+        /*! Get the number of iterations to run. */
+        inline qint64 iterations() const noexcept;
+        /*! Set the number of items processed by all iterations (eg. rows). */
+        inline void setItemsProcessed(qint64 items) noexcept;
+        /*! Get the number of items processed by all iterations. */
+        inline std::optional<qint64> itemsProcessed() const noexcept;
+
+        /*! Get the measured wall time in nanoseconds. */
+        inline qint64 realTime() const noexcept;
+        /*! Get the measured CPU time in nanoseconds. */
+        inline qint64 cpuTime() const noexcept;
+
+    private:
+        /*! Number of iterations to run. */
+        qint64 m_iterations;
+        /*! Number of iterations left. */
+        qint64 m_remaining;
+        /*! Number of items processed by all iterations. */
+        std::optional<qint64> m_itemsProcessed = std::nullopt;
+
+        /*! Wall time timer. */
+        QElapsedTimer m_timer;
+        /*! CPU time at the last start/resume. */
+        std::clock_t m_cpuStart = 0;
+        /*! Accumulated wall time in nanoseconds. */
+        qint64 m_realTime = 0;
+        /*! Accumulated CPU time in nanoseconds. */
+        qint64 m_cpuTime = 0;
+        /*! Determine whether the timer is running. */
+        bool m_running = false;
+        /*! Determine whether the first iteration was already started. */
+        bool m_started = false;
+    };
+
+    /* public */
+
+    qint64 State::iterations() const noexcept
+    {
+        return m_iterations;
+    }
+
+    void State::setItemsProcessed(const qint64 items) noexcept
+    {
+        m_itemsProcessed = items;
+    }
+
+    std::optional<qint64> State::itemsProcessed() const noexcept
+    {
+        return m_itemsProcessed;
+    }
+
+    qint64 State::realTime() const noexcept
+    {
+        return m_realTime;
+    }
+
+    qint64 State::cpuTime() const noexcept
+    {
+        return m_cpuTime;
+    }
+
+    /*! Prevent the compiler from optimizing away the given value (the same as
+        the Google Benchmark's DoNotOptimize()). */
+    template<typename T>
+    inline void doNotOptimize(const T &value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile ("" : : "r,m"(value) : "memory");
+#else
+        static const volatile void *sink = nullptr;
+        sink = &value;
+#endif
+    }
+
+    /*! Result of one benchmark. */
+    struct BenchmarkResult
+    {
+        /*! Benchmark name. */
+        QString name;
+        /*! Number of iterations. */
+        qint64 iterations;
+        /*! Wall time per iteration in nanoseconds. */
+        double realTime;
+        /*! CPU time per iteration in nanoseconds. */
+        double cpuTime;
+        /*! Processed items per second (if the benchmark set processed items). */
+        std::optional<double> itemsPerSecond;
+    };
+
+    /*! Benchmarks runner, runs registered benchmarks, calibrates the number
+        of iterations, and reports results to the console and to the JSON file
+        in the Google Benchmark format (so its compare.py tool can be used). */
+    class Runner
+    {
+        Q_DISABLE_COPY_MOVE(Runner)
+
+    public:
+        /*! Benchmark callback type. */
+        using BenchmarkCallback = std::function<void(State &)>;
+
+        /*! Default constructor. */
+        inline Runner() = default;
+        /*! Default destructor. */
+        inline ~Runner() = default;
+
+        /*! Register a new benchmark. */
+        Runner &add(const QString &name, BenchmarkCallback &&callback);
+
+        /*! Parse the command-line arguments and run matching benchmarks. */
+        int run(const QStringList &arguments);
+
+    private:
+        /*! Registered benchmark. */
+        struct Benchmark
+        {
+            /*! Benchmark name. */
+            QString name;
+            /*! Benchmark callback. */
+            BenchmarkCallback callback;
+        };
+
+        /*! Run the given benchmark until the minimum time is reached. */
+        static BenchmarkResult runBenchmark(const Benchmark &benchmark, double minTime);
+        /*! Predict the number of iterations needed to reach the minimum time. */
+        static qint64 predictIterations(qint64 iterations, qint64 realTime,
+                                        double minTime);
+
+        /*! Print the result to the console. */
+        static void printResult(const BenchmarkResult &result);
+        /*! Write all results to the JSON file. */
+        static bool writeJson(const QString &filepath,
+                              const QVector<BenchmarkResult> &results);
+        /*! Get the context section of the JSON report. */
+        static QJsonObject jsonContext();
+
+        /*! Registered benchmarks. */
+        QVector<Benchmark> m_benchmarks;
+    };
+
+} // namespace Benchmarks::Support
+
+#endif // BENCHMARKS_SUPPORT_BENCHMARK_HPP
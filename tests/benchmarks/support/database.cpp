@@ -0,0 +1,183 @@
+#include "support/database.hpp"
+
+#include <QDateTime>
+
+#include "orm/db.hpp"
+#include "orm/schema.hpp"
+
+using Orm::Constants::CREATED_AT;
+using Orm::Constants::ID;
+using Orm::Constants::NAME;
+using Orm::Constants::QSQLITE;
+using Orm::Constants::UPDATED_AT;
+using Orm::Constants::check_database_exists;
+using Orm::Constants::database_;
+using Orm::Constants::driver_;
+using Orm::Constants::foreign_key_constraints;
+using Orm::Constants::qt_timezone;
+using Orm::Constants::return_qdatetime;
+
+using Orm::DB;
+using Orm::Schema;
+using Orm::SchemaNs::Blueprint;
+
+namespace Benchmarks::Support
+{
+
+/* public */
+
+Database::Database()
+{
+    createConnection();
+    createSchema();
+    seed();
+}
+
+Database::~Database()
+{
+    m_manager->removeConnection(Connection);
+}
+
+/* private */
+
+void Database::createConnection()
+{
+    Q_ASSERT(m_directory.isValid());
+
+    m_manager = DB::create({
+        {driver_,                 QSQLITE},
+        {database_,               m_directory.filePath(
+                                      QStringLiteral("benchmarks.sqlite3"))},
+        {foreign_key_constraints, true},
+        // The database file is created by the QSQLITE driver
+        {check_database_exists,   false},
+        {qt_timezone,             QVariant::fromValue(Qt::UTC)},
+        {return_qdatetime,        true},
+    }, Connection);
+}
+
+void Database::createSchema()
+{
+    Schema::create("authors", [](Blueprint &table)
+    {
+        table.id();
+
+        table.string(NAME);
+        table.string("email");
+        table.timestamps();
+    });
+
+    // Wide table for the hydration benchmarks
+    Schema::create("posts", [](Blueprint &table)
+    {
+        table.id();
+        table.foreignId("author_id").constrained().cascadeOnDelete();
+
+        table.string("title");
+        table.string("slug");
+        table.string("excerpt");
+        table.text("body");
+        table.string("status");
+        table.string("language");
+        table.integer("votes");
+        table.integer("words");
+        table.bigInteger("views");
+        table.Double("score");
+        table.boolean("is_published");
+        table.datetime("published_at").nullable();
+        table.string("note").nullable();
+        table.timestamps();
+    });
+
+    Schema::create("tags", [](Blueprint &table)
+    {
+        table.id();
+
+        table.string(NAME);
+        table.timestamps();
+    });
+
+    Schema::create("post_tag", [](Blueprint &table)
+    {
+        table.foreignId("post_id").constrained().cascadeOnDelete();
+        table.foreignId("tag_id").constrained().cascadeOnDelete();
+
+        table.primary({"post_id", "tag_id"});
+    });
+}
+
+void Database::seed()
+{
+    const auto now = QDateTime::currentDateTimeUtc();
+
+    DB::beginTransaction();
+
+    // Authors
+    {
+        QVector<QVector<QVariant>> authors;
+        authors.reserve(AuthorsCount);
+
+        for (auto id = 1; id <= AuthorsCount; ++id)
+            authors.append({id, QStringLiteral("author %1").arg(id),
+                            QStringLiteral("author%1@example.com").arg(id), now, now});
+
+        DB::table("authors")->insert({ID, NAME, "email", CREATED_AT, UPDATED_AT},
+                                     authors);
+    }
+
+    // Tags
+    {
+        QVector<QVector<QVariant>> tags;
+        tags.reserve(TagsCount);
+
+        for (auto id = 1; id <= TagsCount; ++id)
+            tags.append({id, QStringLiteral("tag %1").arg(id), now, now});
+
+        DB::table("tags")->insert({ID, NAME, CREATED_AT, UPDATED_AT}, tags);
+    }
+
+    // Posts and their tags, inserted per author to stay below the SQLite bindings limit
+    const QVector<QString> postColumns {
+        ID, "author_id", "title", "slug", "excerpt", "body", "status", "language",
+        "votes", "words", "views", "score", "is_published", "published_at", "note",
+        CREATED_AT, UPDATED_AT,
+    };
+    const auto body = QStringLiteral("Lorem ipsum dolor sit amet. ").repeated(20);
+
+    auto postId = 0;
+
+    for (auto authorId = 1; authorId <= AuthorsCount; ++authorId) {
+        QVector<QVector<QVariant>> posts;
+        posts.reserve(PostsPerAuthor);
+        QVector<QVector<QVariant>> postTags;
+        postTags.reserve(PostsPerAuthor * TagsPerPost);
+
+        for (auto i = 0; i < PostsPerAuthor; ++i) {
+            ++postId;
+
+            posts.append({postId, authorId,
+                          QStringLiteral("post %1").arg(postId),
+                          QStringLiteral("post-%1").arg(postId),
+                          QStringLiteral("excerpt of the post %1").arg(postId),
+                          body,
+                          postId % 3 == 0 ? QStringLiteral("draft")
+                                          : QStringLiteral("published"),
+                          QStringLiteral("en"),
+                          postId % 100, 200 + (postId % 50), postId * 10,
+                          static_cast<double>(postId % 10) / 2,
+                          postId % 3 != 0,
+                          postId % 3 == 0 ? QVariant() : QVariant(now),
+                          QVariant(), now, now});
+
+            for (auto t = 0; t < TagsPerPost; ++t)
+                postTags.append({postId, ((postId + t) % TagsCount) + 1});
+        }
+
+        DB::table("posts")->insert(postColumns, posts);
+        DB::table("post_tag")->insert({"post_id", "tag_id"}, postTags);
+    }
+
+    DB::commit();
+}
+
+} // namespace Benchmarks::Support
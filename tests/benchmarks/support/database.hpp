@@ -0,0 +1,57 @@
+#pragma once
+#ifndef BENCHMARKS_SUPPORT_DATABASE_HPP
+#define BENCHMARKS_SUPPORT_DATABASE_HPP
+
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace Orm
+{
+    class DatabaseManager;
+}
+
+namespace Benchmarks::Support
+{
+
+    /*! Temporary SQLite database with the benchmarks schema and seeded data,
+        the database file is removed when the instance is destroyed. */
+    class Database
+    {
+        Q_DISABLE_COPY_MOVE(Database)
+
+    public:
+        /*! Number of seeded authors. */
+        constexpr static auto AuthorsCount = 100;
+        /*! Number of seeded posts for every author. */
+        constexpr static auto PostsPerAuthor = 20;
+        /*! Number of seeded tags. */
+        constexpr static auto TagsCount = 50;
+        /*! Number of seeded tags for every post. */
+        constexpr static auto TagsPerPost = 3;
+
+        /*! Connection name used by benchmarks. */
+        inline static const auto Connection = QStringLiteral("tinyorm_benchmarks");
+
+        /*! Constructor, creates the database, schema, and seeds data. */
+        Database();
+        /*! Destructor, removes the database connection. */
+        ~Database();
+
+    private:
+        /*! Create the database connection. */
+        void createConnection();
+        /*! Create all tables. */
+        static void createSchema();
+        /*! Seed all tables. */
+        static void seed();
+
+        /*! Temporary directory for the SQLite database file. */
+        QTemporaryDir m_directory;
+        /*! Database manager instance. */
+        std::shared_ptr<Orm::DatabaseManager> m_manager;
+    };
+
+} // namespace Benchmarks::Support
+
+#endif // BENCHMARKS_SUPPORT_DATABASE_HPP
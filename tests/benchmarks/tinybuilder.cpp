@@ -0,0 +1,74 @@
+#include "benchmarks.hpp"
+#include "support/benchmark.hpp"
+
+#include "models/post.hpp"
+
+using Benchmarks::Models::Post;
+using Benchmarks::Support::Runner;
+using Benchmarks::Support::State;
+using Benchmarks::Support::doNotOptimize;
+
+namespace Benchmarks
+{
+
+void registerTinyBuilderBenchmarks(Runner &runner)
+{
+    // Posts is the wide table (17 columns), items processed are hydrated rows
+
+    runner.add("TinyBuilder/hydrate/all_posts", [](State &state)
+    {
+        qint64 rows = 0;
+
+        while (state.keepRunning()) {
+            auto posts = Post::all();
+
+            rows += posts.size();
+            doNotOptimize(posts);
+        }
+
+        state.setItemsProcessed(rows);
+    });
+
+    runner.add("TinyBuilder/hydrate/100_posts", [](State &state)
+    {
+        qint64 rows = 0;
+
+        while (state.keepRunning()) {
+            auto posts = Post::limit(100)->get();
+
+            rows += posts.size();
+            doNotOptimize(posts);
+        }
+
+        state.setItemsProcessed(rows);
+    });
+
+    runner.add("TinyBuilder/hydrate/all_posts_forward_only", [](State &state)
+    {
+        qint64 rows = 0;
+
+        while (state.keepRunning()) {
+            auto posts = Post::forwardOnly()->get();
+
+            rows += posts.size();
+            doNotOptimize(posts);
+        }
+
+        state.setItemsProcessed(rows);
+    });
+
+    runner.add("TinyBuilder/cursor/all_posts", [](State &state)
+    {
+        qint64 rows = 0;
+
+        while (state.keepRunning())
+            for (auto &post : Post::cursor()) {
+                ++rows;
+                doNotOptimize(post);
+            }
+
+        state.setItemsProcessed(rows);
+    });
+}
+
+} // namespace Benchmarks
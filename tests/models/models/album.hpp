@@ -34,7 +34,7 @@ public:
 
 private:
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"albumImages", [](auto &v) { v(&Album::albumImages); }},
     };
 
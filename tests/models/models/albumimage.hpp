@@ -33,7 +33,7 @@ public:
 
 private:
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"album", [](auto &v) { v(&AlbumImage::album); }},
     };
 
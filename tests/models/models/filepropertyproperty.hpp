@@ -34,7 +34,7 @@ private:
     QString u_table {"file_property_properties"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"fileProperty", [](auto &v) { v(&FilePropertyProperty::fileProperty); }},
     };
 
@@ -32,7 +32,7 @@ private:
     QString u_table {"user_phones"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"user", [](auto &v) { v(&Phone::user); }},
     };
 
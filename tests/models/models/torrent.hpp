@@ -186,7 +186,7 @@ private:
 //    QString u_primaryKey {ID};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"torrentFiles",  [](auto &v) { v(&Torrent::torrentFiles); }},
         {"torrentPeer",   [](auto &v) { v(&Torrent::torrentPeer); }},
         {"tags",          [](auto &v) { v(&Torrent::tags); }},
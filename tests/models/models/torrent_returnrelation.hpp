@@ -87,7 +87,7 @@ private:
     QString u_table {"torrents"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"torrentFiles", [](auto &v) { v(&Torrent_ReturnRelation::torrentFiles); }},
         {"torrentPeer",  [](auto &v) { v(&Torrent_ReturnRelation::torrentPeer); }},
         {"tags",         [](auto &v) { v(&Torrent_ReturnRelation::tags); }},
@@ -30,7 +30,7 @@ private:
     QString u_table {"torrent_peers"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"torrent", [](auto &v) { v(&TorrentPeerEager::torrent); }},
     };
 
@@ -36,7 +36,7 @@ private:
     QString u_table {"torrent_previewable_files"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"fileProperty", [](auto &v) { v(&TorrentPreviewableFileEager::fileProperty); }},
     };
 
@@ -73,7 +73,7 @@ public:
 
 private:
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"roles",         [](auto &v) { v(&User::roles); }},
         {"roles_appends", [](auto &v) { v(&User::roles_appends); }},
         {"phone",         [](auto &v) { v(&User::phone); }},
@@ -7,4 +7,8 @@ SUBDIRS = \
 !disable_tom: \
     SUBDIRS += testdata_tom
 
+# Can be enabled by CONFIG += build_benchmarks when the qmake.exe for the project is called
+build_benchmarks: \
+    SUBDIRS += benchmarks
+
 auto.depends = TinyUtils
@@ -156,7 +156,7 @@ private:)";
 inline const auto *const ModelRelationsStub =
 R"(
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
 {{ relationItems }}
     };)";
 